@@ -0,0 +1,121 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/allocation_policy.hpp"
+
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+#include "std_e/multi_index/cartesian_product_size.hpp"
+#include "cpp_cgns/base/parallel_tree.hpp"
+#include "cpp_cgns/dispatch.hpp"
+
+
+namespace cgns {
+
+
+// allocation_policy {
+namespace {
+  auto
+  global_allocation_policy() -> allocation_policy& {
+    static allocation_policy policy;
+    return policy;
+  }
+}
+
+auto
+default_allocation_policy() -> const allocation_policy& {
+  return global_allocation_policy();
+}
+auto
+set_default_allocation_policy(const allocation_policy& policy) -> allocation_policy {
+  return std::exchange(global_allocation_policy(),policy);
+}
+// allocation_policy }
+
+
+// raw allocation {
+namespace {
+  auto
+  round_up(size_t n, size_t alignment) -> size_t {
+    return (n+alignment-1)/alignment*alignment;
+  }
+
+  // under this size per thread, starting the threads costs more than the copy,
+  // and the placement of a few pages does not matter
+  constexpr size_t first_touch_min_bytes_per_thread = 4*huge_page_size;
+}
+
+auto
+allocate_bytes(size_t n_bytes, const allocation_policy& policy) -> void* {
+  if (n_bytes==0) return nullptr;
+  size_t alignment = std::max(policy.alignment,alignof(std::max_align_t));
+  if ((alignment & (alignment-1)) != 0) {
+    throw cgns_exception("allocate_bytes: alignment "+std::to_string(alignment)+" is not a power of 2");
+  }
+  bool use_huge_pages = policy.huge_pages && n_bytes>=huge_page_size;
+  if (use_huge_pages) alignment = std::max(alignment,huge_page_size);
+
+  size_t alloc_size = round_up(n_bytes,alignment); // required by aligned_alloc
+  void* ptr = std::aligned_alloc(alignment,alloc_size);
+  if (ptr==nullptr) throw std::bad_alloc();
+
+  #ifdef MADV_HUGEPAGE
+    if (use_huge_pages) ::madvise(ptr,alloc_size,MADV_HUGEPAGE); // only a hint: failure is not an error
+  #endif
+  return ptr;
+}
+auto
+deallocate_bytes(void* ptr) -> void {
+  std::free(ptr);
+}
+
+auto
+copy_bytes(const void* src, size_t n_bytes, void* dst, const allocation_policy& policy) -> void {
+  if (n_bytes==0) return; // `src` and `dst` may be null
+  int n_threads = policy.first_touch_threads;
+  if (n_threads<=1 || n_bytes < n_threads*first_touch_min_bytes_per_thread) {
+    std::memcpy(dst,src,n_bytes);
+    return;
+  }
+  // one contiguous chunk per thread, page-aligned so that no page is shared
+  size_t chunk_size = round_up((n_bytes+n_threads-1)/n_threads,4096);
+  run_tasks(n_threads,n_threads,[=](int i){
+    size_t start = std::min(i*chunk_size,n_bytes);
+    size_t finish = std::min(start+chunk_size,n_bytes);
+    std::memcpy((char*)dst+start,(const char*)src+start,finish-start);
+  });
+}
+// raw allocation }
+
+
+// node_value {
+auto
+make_node_value(data_type_id data_type, const void* data, std::vector<I8> dims, const allocation_policy& policy) -> node_value {
+  return dispatch_on_data_type(
+    data_type,
+    [&]<class T>(T) -> node_value {
+      size_t n = std_e::cartesian_product_size(dims);
+      aligned_array<T> arr(n,policy);
+      copy_bytes(data,n*sizeof(T),arr.data(),policy);
+      return node_value(std::move(arr),std::move(dims));
+    }
+  );
+}
+
+auto
+reallocate_values(tree& t, const allocation_policy& policy) -> void {
+  const node_value& old_val = value(std::as_const(t)); // const: no copy-on-write detach
+  if (old_val.type_id()!=data_type_id::MT) {
+    node_value new_val = make_node_value(old_val.type_id(),old_val.data(),old_val.extent(),policy);
+    set_value(t,std::move(new_val));
+  }
+  for (tree& c : children(t)) {
+    reallocate_values(c,policy);
+  }
+}
+// node_value }
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,124 @@
+#pragma once
+
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// allocation_policy {
+/// how the memory of the node values created by the library is allocated
+// [Sphinx Doc] allocation_policy {
+struct allocation_policy {
+  /// alignment of the arrays, in bytes (must be a power of 2)
+  size_t alignment = 64;
+  /// if true, arrays of at least `huge_page_size` bytes are aligned on huge pages and the kernel is advised to back them by huge pages
+  bool huge_pages = false;
+  /// if >1, the arrays are first written by this number of threads, each one writing a contiguous chunk,
+  /// so that the memory pages are placed on the NUMA nodes of the threads that will later work on the same chunks
+  /// (arrays smaller than a few huge pages per thread are written by the calling thread only)
+  int first_touch_threads = 1;
+};
+// [Sphinx Doc] allocation_policy }
+
+inline constexpr size_t huge_page_size = 2 << 20; // 2 MiB
+
+/// the policy used by `make_node_value` and `clone`
+auto default_allocation_policy() -> const allocation_policy&;
+/// returns the previous default policy
+auto set_default_allocation_policy(const allocation_policy& policy) -> allocation_policy;
+
+// Within the lifetime of an allocation_policy_scope, `policy` is the default policy
+// Note: it replaces a global setting, hence it is not thread-safe
+class allocation_policy_scope {
+  public:
+    allocation_policy_scope(const allocation_policy& policy)
+      : prev(set_default_allocation_policy(policy))
+    {}
+
+    allocation_policy_scope(const allocation_policy_scope&) = delete;
+    allocation_policy_scope& operator=(const allocation_policy_scope&) = delete;
+
+    ~allocation_policy_scope() {
+      set_default_allocation_policy(prev);
+    }
+  private:
+    allocation_policy prev;
+};
+// allocation_policy }
+
+
+// raw allocation {
+/// the memory is not initialized
+auto allocate_bytes(size_t n_bytes, const allocation_policy& policy) -> void*;
+auto deallocate_bytes(void* ptr) -> void;
+/// copies `n_bytes` from `src` to `dst`, with first-touch placement if required by `policy`
+auto copy_bytes(const void* src, size_t n_bytes, void* dst, const allocation_policy& policy) -> void;
+// raw allocation }
+
+
+// aligned_array {
+/// owning contiguous array allocated according to an allocation_policy
+/// T is a CGNS data type, hence trivial: the elements are not initialized at construction
+template<Data_type T>
+class aligned_array {
+  public:
+    using value_type = T;
+
+  // ctors
+    aligned_array() = default;
+    aligned_array(size_t n, const allocation_policy& policy = default_allocation_policy())
+      : ptr(static_cast<T*>(allocate_bytes(n*sizeof(T),policy)))
+      , n(n)
+    {}
+
+    aligned_array(aligned_array&& x)
+      : ptr(std::exchange(x.ptr,nullptr))
+      , n(std::exchange(x.n,0))
+    {}
+    aligned_array& operator=(aligned_array&& x) {
+      std::swap(ptr,x.ptr);
+      std::swap(n,x.n);
+      return *this;
+    }
+    aligned_array(const aligned_array&) = delete;
+    aligned_array& operator=(const aligned_array&) = delete;
+
+    ~aligned_array() {
+      deallocate_bytes(ptr);
+    }
+
+  // access
+    auto data()       ->       T* { return ptr; }
+    auto data() const -> const T* { return ptr; }
+    auto size() const -> size_t { return n; }
+
+    auto begin()       ->       T* { return ptr; }
+    auto begin() const -> const T* { return ptr; }
+    auto end()         ->       T* { return ptr+n; }
+    auto end()   const -> const T* { return ptr+n; }
+
+    auto operator[](I8 i)       ->       T& { return ptr[i]; }
+    auto operator[](I8 i) const -> const T& { return ptr[i]; }
+  private:
+    T* ptr = nullptr;
+    size_t n = 0;
+};
+// aligned_array }
+
+
+// [Sphinx Doc] aligned node_value {
+/// copies `data` into a new array allocated according to `policy`
+auto make_node_value(data_type_id data_type, const void* data, std::vector<I8> dims, const allocation_policy& policy) -> node_value;
+
+/// re-allocates all the values of `t` according to `policy`
+/// Note: values that did not own their memory (e.g. spans or memory-mapped arrays) are copied, and own their memory afterwards
+auto reallocate_values(tree& t, const allocation_policy& policy) -> void;
+// [Sphinx Doc] aligned node_value }
+
+
+} // cgns
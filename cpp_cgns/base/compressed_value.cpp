@@ -0,0 +1,221 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/compressed_value.hpp"
+
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+#include "std_e/multi_index/cartesian_product_size.hpp"
+#include "cpp_cgns/dispatch.hpp"
+
+
+namespace cgns {
+
+
+// varint {
+namespace {
+
+auto
+write_varint(std::uint64_t x, std::vector<std::byte>& out) -> void {
+  while (x >= 0x80) {
+    out.push_back(std::byte((x & 0x7f) | 0x80));
+    x >>= 7;
+  }
+  out.push_back(std::byte(x));
+}
+auto
+read_varint(const std::byte*& p, const std::byte* end) -> std::uint64_t {
+  std::uint64_t x = 0;
+  for (int shift=0; shift<64; shift+=7) {
+    if (p==end) throw cgns_exception("decompress: truncated compressed value");
+    std::uint64_t b = std::to_integer<std::uint64_t>(*p++);
+    x |= (b & 0x7f) << shift;
+    if ((b & 0x80) == 0) return x;
+  }
+  throw cgns_exception("decompress: invalid variable-length integer");
+}
+
+auto
+zigzag(std::int64_t x) -> std::uint64_t {
+  return (std::uint64_t(x) << 1) ^ std::uint64_t(x >> 63);
+}
+auto
+unzigzag(std::uint64_t x) -> std::int64_t {
+  return std::int64_t(x >> 1) ^ -std::int64_t(x & 1);
+}
+
+template<class T> using same_size_uint = std::conditional_t<sizeof(T)==4,std::uint32_t,std::uint64_t>;
+
+} // anonymous
+// varint }
+
+
+// codecs {
+namespace {
+
+template<class I> auto
+encode_delta_varint(const I* x, size_t n, std::vector<std::byte>& out) -> void {
+  I prev = 0;
+  for (size_t i=0; i<n; ++i) {
+    // the difference is computed with the unsigned type to avoid overflows
+    using U = same_size_uint<I>;
+    I diff = I(U(x[i])-U(prev));
+    write_varint(zigzag(diff),out);
+    prev = x[i];
+  }
+}
+template<class I> auto
+decode_delta_varint(const std::byte* p, const std::byte* end, size_t n, I* x) -> void {
+  using U = same_size_uint<I>;
+  I prev = 0;
+  for (size_t i=0; i<n; ++i) {
+    I diff = I(unzigzag(read_varint(p,end)));
+    prev = I(U(prev)+U(diff));
+    x[i] = prev;
+  }
+}
+
+template<class R> auto
+encode_xor_varint(const R* x, size_t n, std::vector<std::byte>& out) -> void {
+  using U = same_size_uint<R>;
+  U prev = 0;
+  for (size_t i=0; i<n; ++i) {
+    U bits = std::bit_cast<U>(x[i]);
+    write_varint(bits^prev,out); // close values share their sign, exponent and high mantissa bits: the xor is small
+    prev = bits;
+  }
+}
+template<class R> auto
+decode_xor_varint(const std::byte* p, const std::byte* end, size_t n, R* x) -> void {
+  using U = same_size_uint<R>;
+  U prev = 0;
+  for (size_t i=0; i<n; ++i) {
+    prev ^= U(read_varint(p,end));
+    x[i] = std::bit_cast<R>(prev);
+  }
+}
+
+template<class T> constexpr auto
+codec_of() -> value_codec {
+  if constexpr (std::is_integral_v<T> && sizeof(T)>1) return value_codec::delta_varint;
+  if constexpr (std::is_floating_point_v<T>) return value_codec::xor_varint;
+  return value_codec::raw;
+}
+
+template<class T> auto
+raw_bytes(const T* x, size_t n) -> std::vector<std::byte> {
+  std::vector<std::byte> res(n*sizeof(T));
+  std::memcpy(res.data(),x,n*sizeof(T));
+  return res;
+}
+
+} // anonymous
+
+auto
+number_of_values(const compressed_value& x) -> size_t {
+  if (x.data_type==data_type_id::MT) return 0;
+  return std_e::cartesian_product_size(x.dims);
+}
+
+auto
+compress(const node_value& x) -> compressed_value {
+  compressed_value res;
+  res.data_type = x.type_id();
+  if (res.data_type==data_type_id::MT) return res;
+  res.dims = x.extent();
+
+  dispatch_on_data_type(
+    res.data_type,
+    [&x,&res]<class T>(T){
+      const T* data = data_as<T>(x);
+      size_t n = x.size();
+      constexpr value_codec codec = codec_of<T>();
+      if constexpr (codec==value_codec::delta_varint) encode_delta_varint(data,n,res.bytes);
+      if constexpr (codec==value_codec::xor_varint  ) encode_xor_varint  (data,n,res.bytes);
+      if (codec==value_codec::raw || res.bytes.size() >= n*sizeof(T)) { // compression is not worth it
+        res.codec = value_codec::raw;
+        res.bytes = raw_bytes(data,n);
+      } else {
+        res.codec = codec;
+        res.bytes.shrink_to_fit();
+      }
+    }
+  );
+  return res;
+}
+
+auto
+decompress_into(const compressed_value& x, void* out) -> void {
+  if (x.data_type==data_type_id::MT) return;
+  dispatch_on_data_type(
+    x.data_type,
+    [&x,out]<class T>(T){
+      size_t n = number_of_values(x);
+      T* data = static_cast<T*>(out);
+      const std::byte* p = x.bytes.data();
+      const std::byte* end = p+x.bytes.size();
+      switch (x.codec) {
+        case value_codec::raw: {
+          if (x.bytes.size()!=n*sizeof(T)) throw cgns_exception("decompress: raw value of wrong size");
+          std::memcpy(data,p,n*sizeof(T));
+          return;
+        }
+        case value_codec::delta_varint: {
+          if constexpr (codec_of<T>()==value_codec::delta_varint) {
+            decode_delta_varint(p,end,n,data);
+            return;
+          }
+          break;
+        }
+        case value_codec::xor_varint: {
+          if constexpr (codec_of<T>()==value_codec::xor_varint) {
+            decode_xor_varint(p,end,n,data);
+            return;
+          }
+          break;
+        }
+      }
+      throw cgns_exception("decompress: codec not supported for data type "+to_string<T>());
+    }
+  );
+}
+
+auto
+decompress(const compressed_value& x) -> node_value {
+  if (x.data_type==data_type_id::MT) return MT();
+  return dispatch_on_data_type(
+    x.data_type,
+    [&x]<class T>(T) -> node_value {
+      std::vector<T> v(number_of_values(x));
+      decompress_into(x,v.data());
+      return node_value(std::move(v),x.dims);
+    }
+  );
+}
+// codecs }
+
+
+// lazy node_value {
+auto
+make_lazy_node_value(std::shared_ptr<const compressed_value> x) -> node_value {
+  if (x->data_type==data_type_id::MT) return MT();
+  std::vector<I8> dims = x->dims;
+  return dispatch_on_data_type(
+    x->data_type,
+    [&x,&dims]<class T>(T) -> node_value {
+      return node_value(lazy_decompressed_array<T>(std::move(x)),std::move(dims));
+    }
+  );
+}
+
+auto
+recompress(node_value& x) -> std::shared_ptr<const compressed_value> {
+  auto cx = std::make_shared<const compressed_value>(compress(x));
+  x = make_lazy_node_value(cx);
+  return cx;
+}
+// lazy node_value }
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,158 @@
+#pragma once
+
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// codecs {
+enum class value_codec {
+  raw,          // no compression
+  delta_varint, // integers: differences between consecutive values, zigzag-encoded, then variable-length bytes
+  xor_varint    // floats: bits xor-ed with the previous value, then variable-length bytes
+};
+
+/// node value in a compressed form
+/// all the codecs are lossless
+struct compressed_value {
+  data_type_id data_type = data_type_id::MT;
+  std::vector<I8> dims;
+  value_codec codec = value_codec::raw;
+  std::vector<std::byte> bytes;
+};
+
+/// chooses the codec from the data type (delta_varint for I4/I8, xor_varint for R4/R8, raw for C1)
+/// if the compressed form is bigger than the raw one, the raw one is kept
+auto compress(const node_value& x) -> compressed_value;
+auto decompress(const compressed_value& x) -> node_value;
+/// decompresses into `out`, whose size must be that of the value
+auto decompress_into(const compressed_value& x, void* out) -> void;
+// codecs }
+
+
+// lazy_decompressed_array {
+/// range whose data is decompressed the first time it is accessed
+/// the compressed value is shared (several node values can be created from it without copy)
+/// Note: writes only modify the decompressed cache, not the compressed value (see `recompress`)
+template<Data_type T>
+class lazy_decompressed_array {
+  public:
+    using value_type = T;
+
+    lazy_decompressed_array(std::shared_ptr<const compressed_value> x)
+      : state(std::make_unique<lazy_state>(std::move(x)))
+    {}
+
+    auto
+    size() const -> size_t {
+      return state->n;
+    }
+    auto
+    data() -> T* {
+      return decompressed();
+    }
+    auto
+    data() const -> const T* {
+      return decompressed();
+    }
+
+    auto begin()       ->       T* { return data(); }
+    auto begin() const -> const T* { return data(); }
+    auto end()         ->       T* { return data()+size(); }
+    auto end()   const -> const T* { return data()+size(); }
+
+    auto operator[](I8 i)       ->       T& { return data()[i]; }
+    auto operator[](I8 i) const -> const T& { return data()[i]; }
+
+    auto
+    is_decompressed() const -> bool {
+      return state->is_decompressed;
+    }
+  private:
+    struct lazy_state {
+      lazy_state(std::shared_ptr<const compressed_value> x);
+
+      std::shared_ptr<const compressed_value> compressed;
+      size_t n;
+      std::once_flag decompressed_flag;
+      std::atomic<bool> is_decompressed = false;
+      std::vector<T> cache;
+    };
+
+    auto
+    decompressed() const -> T* {
+      std::call_once(state->decompressed_flag,[this](){
+        state->cache.resize(state->n);
+        decompress_into(*state->compressed,state->cache.data());
+        state->is_decompressed = true;
+      });
+      return state->cache.data();
+    }
+
+    std::unique_ptr<lazy_state> state; // unique_ptr: once_flag is not movable
+};
+// lazy_decompressed_array }
+
+
+// [Sphinx Doc] compressed node_value {
+/// node_value backed by `x`: it is decompressed on the first access to its data (e.g. by `data_as` or `view_as_span`)
+/// until then, only the compressed form uses memory
+/// Note: writes to the data only modify the decompressed memory, not `x`
+auto make_lazy_node_value(std::shared_ptr<const compressed_value> x) -> node_value;
+
+/// frees the decompressed memory of `x`, keeping its data (including the modifications) compressed:
+/// `x` is replaced by a lazy node_value of its compressed data, which is returned
+auto recompress(node_value& x) -> std::shared_ptr<const compressed_value>;
+
+/// replaces the values of `t` and its descendants for which `pred(node)` is true by lazily decompressed node values
+/// returns the compressed values, so that they can be kept, e.g. to free the decompressed memory later
+template<class Tree_predicate> auto
+compress_values(tree& t, Tree_predicate pred) -> std::vector<std::shared_ptr<const compressed_value>>;
+// [Sphinx Doc] compressed node_value }
+
+
+// ====================== impl ======================
+auto number_of_values(const compressed_value& x) -> size_t;
+
+template<Data_type T>
+lazy_decompressed_array<T>::lazy_state::
+lazy_state(std::shared_ptr<const compressed_value> x)
+  : compressed(std::move(x))
+  , n(number_of_values(*compressed))
+{
+  if (compressed->data_type!=type_id_of<T>) {
+    throw cgns_exception("lazy_decompressed_array<"+to_string<T>()+">: compressed value is of type "+to_string(compressed->data_type));
+  }
+}
+
+namespace detail {
+  template<class Tree_predicate> auto
+  compress_values_impl(tree& t, Tree_predicate& pred, std::vector<std::shared_ptr<const compressed_value>>& res) -> void {
+    if (value(std::as_const(t)).type_id()!=data_type_id::MT && pred(std::as_const(t))) {
+      auto x = std::make_shared<const compressed_value>(compress(value(std::as_const(t))));
+      set_value(t,make_lazy_node_value(x)); // not `value(t)`: a value shared by `cow_clone` would be copied first
+      res.push_back(std::move(x));
+    }
+    for (tree& c : children(t)) {
+      compress_values_impl(c,pred,res);
+    }
+  }
+}
+
+template<class Tree_predicate> auto
+compress_values(tree& t, Tree_predicate pred) -> std::vector<std::shared_ptr<const compressed_value>> {
+  std::vector<std::shared_ptr<const compressed_value>> res;
+  detail::compress_values_impl(t,pred,res);
+  return res;
+}
+
+
+} // cgns
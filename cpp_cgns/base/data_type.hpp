@@ -2,6 +2,7 @@
 
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include "cpp_cgns/base/exception.hpp"
 #include "std_e/utils/enum.hpp"
@@ -42,15 +43,69 @@ template<> inline     auto to_string<R4>() -> std::string { return "R4"; }
 template<> inline     auto to_string<R8>() -> std::string { return "R8"; }
 
 
+// data_type_id {
+/// compact identifier of the data type of a node value
+/// it is cheap to compute and to compare: prefer it to the string form, that should only be used for I/O
+// [Sphinx Doc] data_type_id {
+enum class data_type_id : std::uint8_t {
+  MT, C1, I4, I8, R4, R8
+};
+// [Sphinx Doc] data_type_id }
+
+template<Data_type T> constexpr data_type_id type_id_of     = data_type_id::MT; // never used, only the specializations are
+template<>            constexpr data_type_id type_id_of<C1> = data_type_id::C1;
+template<>            constexpr data_type_id type_id_of<I4> = data_type_id::I4;
+template<>            constexpr data_type_id type_id_of<I8> = data_type_id::I8;
+template<>            constexpr data_type_id type_id_of<R4> = data_type_id::R4;
+template<>            constexpr data_type_id type_id_of<R8> = data_type_id::R8;
+
+constexpr auto
+to_string_view(data_type_id id) -> std::string_view {
+  switch (id) {
+    case data_type_id::MT: return "MT";
+    case data_type_id::C1: return "C1";
+    case data_type_id::I4: return "I4";
+    case data_type_id::I8: return "I8";
+    case data_type_id::R4: return "R4";
+    case data_type_id::R8: return "R8";
+  }
+  return "Unknown CGNS data_type";
+}
 inline auto
-n_byte(const std::string& dt) -> int {
-  if (dt=="C1") return 1;
-  if (dt=="I4") return 4;
-  if (dt=="I8") return 8;
-  if (dt=="R4") return 4;
-  if (dt=="R8") return 8;
-  else throw cgns_exception("n_byte: unknown data type \"" + dt + "\"");
+to_string(data_type_id id) -> std::string {
+  return std::string(to_string_view(id));
+}
+
+inline auto
+to_data_type_id(std::string_view dt) -> data_type_id {
+  if (dt=="MT") return data_type_id::MT;
+  if (dt=="C1") return data_type_id::C1;
+  if (dt=="I4") return data_type_id::I4;
+  if (dt=="I8") return data_type_id::I8;
+  if (dt=="R4") return data_type_id::R4;
+  if (dt=="R8") return data_type_id::R8;
+  throw cgns_exception("to_data_type_id: unknown data type \"" + std::string(dt) + "\"");
 }
+// data_type_id }
+
 
+constexpr auto
+n_byte(data_type_id id) -> int {
+  switch (id) {
+    case data_type_id::C1: return 1;
+    case data_type_id::I4: return 4;
+    case data_type_id::I8: return 8;
+    case data_type_id::R4: return 4;
+    case data_type_id::R8: return 8;
+    case data_type_id::MT: break;
+  }
+  throw cgns_exception("n_byte: no byte size for data type \"" + to_string(id) + "\"");
+}
+inline auto
+n_byte(const std::string& dt) -> int {
+  data_type_id id = to_data_type_id(dt);
+  if (id==data_type_id::MT) throw cgns_exception("n_byte: unknown data type \"" + dt + "\"");
+  return n_byte(id);
+}
 
 } // cgns
@@ -0,0 +1,196 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/data_type_conversion.hpp"
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include "cpp_cgns/base/allocation_policy.hpp"
+#include "cpp_cgns/base/parallel_tree.hpp"
+#include "cpp_cgns/dispatch.hpp"
+
+
+namespace cgns {
+
+
+namespace {
+
+constexpr I8 conversion_chunk_size = 1 << 18;
+
+/// calls `f(start,finish)` on chunks of [0,n)
+template<class F> auto
+for_each_chunk(I8 n, int n_threads, F f) -> void {
+  int n_chunks = (n+conversion_chunk_size-1)/conversion_chunk_size;
+  run_tasks(n_chunks,n_threads,[n,&f](int c){
+    I8 start = c*conversion_chunk_size;
+    I8 finish = std::min(start+conversion_chunk_size,n);
+    f(start,finish);
+  });
+}
+
+template<class To, class From> auto
+fits(From x) -> bool {
+  if constexpr (std::is_integral_v<From>) {
+    return std::numeric_limits<To>::min()<=x && x<=std::numeric_limits<To>::max();
+  } else {
+    return !std::isfinite(x) || std::abs(x)<=std::numeric_limits<To>::max(); // inf and nan are preserved
+  }
+}
+
+template<class To, class From> auto
+check_range(const From* x, I8 n, int n_threads) -> void {
+  if constexpr (sizeof(To) < sizeof(From)) {
+    std::atomic<bool> all_fit = true;
+    for_each_chunk(n,n_threads,[x,&all_fit](I8 start, I8 finish){
+      bool chunk_fits = true;
+      for (I8 i=start; i<finish; ++i) {
+        chunk_fits &= fits<To>(x[i]); // no early exit: keeps the loop vectorizable
+      }
+      if (!chunk_fits) all_fit = false;
+    });
+    if (!all_fit) {
+      throw cgns_exception("convert_data_type: narrowing conversion from "+to_string<From>()+" to "+to_string<To>()
+                         + " of a value that does not fit");
+    }
+  }
+}
+
+/// array whose memory is that of an array of `From` of the same size, converted in place to `To`
+/// (`sizeof(To)<sizeof(From)`: the end of the memory is unused)
+template<class To, class From>
+class narrowed_array {
+  public:
+    using value_type = To;
+
+    narrowed_array(std_e::polymorphic_array<From>&& x, size_t n)
+      : owner(std::move(x))
+      , n(n)
+    {}
+
+    auto data()       ->       To* { return reinterpret_cast<      To*>(owner.data()); }
+    auto data() const -> const To* { return reinterpret_cast<const To*>(owner.data()); }
+    auto size() const -> size_t { return n; }
+
+    auto begin()       ->       To* { return data(); }
+    auto begin() const -> const To* { return data(); }
+    auto end()         ->       To* { return data()+n; }
+    auto end()   const -> const To* { return data()+n; }
+
+    auto operator[](I8 i)       ->       To& { return data()[i]; }
+    auto operator[](I8 i) const -> const To& { return data()[i]; }
+  private:
+    std_e::polymorphic_array<From> owner;
+    size_t n;
+};
+
+template<class To, class From> auto
+convert_to_new_array(node_value& x, const conversion_options& opts) -> void {
+  const From* src = data_as<From>(std::as_const(x));
+  I8 n = x.size();
+  aligned_array<To> res(n);
+  To* dst = res.data();
+  for_each_chunk(n,opts.n_threads,[src,dst](I8 start, I8 finish){
+    for (I8 i=start; i<finish; ++i) {
+      dst[i] = To(src[i]);
+    }
+  });
+  std::vector<I8> dims = x.extent();
+  x = node_value(std::move(res),std::move(dims));
+}
+
+template<class To, class From> auto
+convert_in_place(node_value& x) -> void {
+  std::byte* mem = reinterpret_cast<std::byte*>(data_as<From>(x));
+  I8 n = x.size();
+  // sequential: the value i is written at bytes [i*sizeof(To),(i+1)*sizeof(To)), where no value j>=i is stored
+  for (I8 i=0; i<n; ++i) {
+    From v;
+    std::memcpy(&v,mem+i*sizeof(From),sizeof(From));
+    To w = To(v);
+    std::memcpy(mem+i*sizeof(To),&w,sizeof(To));
+  }
+
+  auto& arrays = x.underlying_range().underlying_variant();
+  auto arr = std::move(std::get<std_e::polymorphic_array<From>>(arrays));
+  std::vector<I8> dims = x.extent();
+  x = node_value(narrowed_array<To,From>(std::move(arr),n),std::move(dims));
+}
+
+template<class To, class From> auto
+convert(node_value& x, const conversion_options& opts) -> void {
+  check_range<To>(data_as<From>(std::as_const(x)),x.size(),opts.n_threads);
+  if (sizeof(To)<sizeof(From) && opts.in_place_narrowing) {
+    convert_in_place<To,From>(x);
+  } else {
+    convert_to_new_array<To,From>(x,opts);
+  }
+}
+
+auto
+is_integral(data_type_id id) -> bool {
+  return id==data_type_id::I4 || id==data_type_id::I8;
+}
+auto
+is_floating_point(data_type_id id) -> bool {
+  return id==data_type_id::R4 || id==data_type_id::R8;
+}
+
+} // anonymous
+
+
+auto
+convert_data_type(node_value& x, data_type_id to, const conversion_options& opts) -> void {
+  data_type_id from = x.type_id();
+  if (from==to) return;
+  if (!(is_integral(from) && is_integral(to)) && !(is_floating_point(from) && is_floating_point(to))) {
+    throw cgns_exception("convert_data_type: conversion from "+to_string(from)+" to "+to_string(to)+" is not supported");
+  }
+  dispatch<data_type_list<I4,I8,R4,R8>>(
+    [&x,to,&opts]<class From>(From){
+      dispatch_on_data_type(to,[&x,&opts]<class To>(To){
+        if constexpr (std::is_integral_v<From>==std::is_integral_v<To>) {
+          convert<To,From>(x,opts);
+        }
+      });
+    },
+    x
+  );
+}
+
+namespace {
+  /// `label_ids`: nullptr if all the labels are converted
+  auto
+  convert_all_impl(tree& t, data_type_id from, data_type_id to, const std::vector<node_label>* label_ids, const conversion_options& opts) -> int {
+    int n_converted = 0;
+    if (value(std::as_const(t)).type_id()==from && (!label_ids || std::find(begin(*label_ids),end(*label_ids),label(t))!=end(*label_ids))) {
+      if (is_value_shared(t)) {
+        // copy-on-write: convert directly from the shared value, rather than copying it before converting the copy
+        const node_value& shared = value(std::as_const(t));
+        node_value x = make_non_owning_node_value(shared.type_id(),const_cast<void*>(shared.data()),shared.extent());
+        conversion_options new_array_opts = opts;
+        new_array_opts.in_place_narrowing = false;
+        convert_data_type(x,to,new_array_opts);
+        set_value(t,std::move(x));
+      } else {
+        convert_data_type(mutable_value(t),to,opts);
+      }
+      ++n_converted;
+    }
+    for (tree& c : children(t)) {
+      n_converted += convert_all_impl(c,from,to,label_ids,opts);
+    }
+    return n_converted;
+  }
+}
+
+auto
+convert_all(tree& t, data_type_id from, data_type_id to, const std::vector<std::string>& labels, const conversion_options& opts) -> int {
+  if (labels.empty()) return convert_all_impl(t,from,to,nullptr,opts);
+  std::vector<node_label> label_ids = find_labels(labels); // labels never interned can't match any node
+  return convert_all_impl(t,from,to,&label_ids,opts);
+}
+
+
+} // cgns
+#endif // C++>17
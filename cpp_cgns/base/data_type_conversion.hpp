@@ -0,0 +1,34 @@
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+struct conversion_options {
+  /// number of threads used for the conversion of big arrays
+  int n_threads = 1;
+  /// if true, narrowing conversions (I8->I4, R8->R4) reuse the memory of the array instead of allocating a new one
+  /// Only set it if the node values own their memory: it is overwritten even if they don't
+  /// (e.g. a span, a numpy buffer from `view_as_node_value`, or a file mapped by `load_binary_tree`, which may be read-only)
+  bool in_place_narrowing = false;
+};
+
+// [Sphinx Doc] data type conversion {
+/// converts `x` to data type `to`
+/// only conversions between integers (I4<->I8) or between floating point numbers (R4<->R8) are supported
+/// narrowing conversions are range-checked: if a value does not fit in the new type, an exception is thrown and `x` is left unchanged
+auto convert_data_type(node_value& x, data_type_id to, const conversion_options& opts = {}) -> void;
+
+/// converts the values of type `from` of `t` and its descendants to type `to`
+/// if `labels` is not empty, only the nodes with one of these labels are converted
+/// returns the number of converted values
+auto convert_all(tree& t, data_type_id from, data_type_id to, const std::vector<std::string>& labels = {}, const conversion_options& opts = {}) -> int;
+// [Sphinx Doc] data type conversion }
+
+
+} // cgns
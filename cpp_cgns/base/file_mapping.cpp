@@ -0,0 +1,107 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/file_mapping.hpp"
+
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "std_e/multi_index/cartesian_product_size.hpp"
+#include "cpp_cgns/dispatch.hpp"
+
+
+namespace cgns {
+
+
+// file_mapping {
+namespace {
+  auto
+  system_error_msg() -> std::string {
+    return std::strerror(errno);
+  }
+
+  struct file_descriptor {
+    int fd;
+    ~file_descriptor() { if (fd>=0) ::close(fd); } // the mapping stays valid after close
+  };
+}
+
+file_mapping::
+file_mapping(const std::string& file_name, mapping_mode mode, I8 offset, I8 length)
+  : mode_(mode)
+{
+  file_descriptor f = {::open(file_name.c_str(),O_RDONLY)};
+  if (f.fd<0) {
+    throw cgns_exception("file_mapping: unable to open file \""+file_name+"\": "+system_error_msg());
+  }
+  struct stat st;
+  if (::fstat(f.fd,&st)!=0) {
+    throw cgns_exception("file_mapping: unable to get the size of file \""+file_name+"\": "+system_error_msg());
+  }
+  I8 file_size = st.st_size;
+  if (length<0) length = file_size-offset;
+  if (offset<0 || length<0 || offset+length>file_size) {
+    throw cgns_exception(
+      "file_mapping: region ["+std::to_string(offset)+","+std::to_string(offset+length)+")"
+      " is out of file \""+file_name+"\" of size "+std::to_string(file_size)
+    );
+  }
+  size_ = length;
+
+  I8 page_size = ::sysconf(_SC_PAGE_SIZE);
+  I8 map_offset = (offset/page_size)*page_size;
+  I8 delta = offset-map_offset;
+  map_size = delta+length;
+  if (map_size==0) { // mmap does not accept empty regions
+    map_start = nullptr;
+    data_ = nullptr;
+    return;
+  }
+
+  int prot  = mode==mapping_mode::read_only ? PROT_READ : PROT_READ|PROT_WRITE;
+  int flags = mode==mapping_mode::read_only ? MAP_SHARED : MAP_PRIVATE;
+  map_start = ::mmap(nullptr,map_size,prot,flags,f.fd,map_offset);
+  if (map_start==MAP_FAILED) {
+    throw cgns_exception("file_mapping: unable to map file \""+file_name+"\": "+system_error_msg());
+  }
+  data_ = static_cast<std::byte*>(map_start)+delta;
+}
+
+file_mapping::
+~file_mapping() {
+  if (map_start) ::munmap(map_start,map_size);
+}
+
+auto
+map_file(const std::string& file_name, mapping_mode mode, I8 offset, I8 length) -> std::shared_ptr<file_mapping> {
+  return std::make_shared<file_mapping>(file_name,mode,offset,length);
+}
+// file_mapping }
+
+
+// make_mapped_node_value {
+auto
+make_mapped_node_value(std::shared_ptr<file_mapping> mapping, data_type_id data_type, I8 byte_offset, std::vector<I8> dims) -> node_value {
+  I8 n = std_e::cartesian_product_size(dims);
+  I8 n_bytes = n*n_byte(data_type);
+  if (byte_offset<0 || byte_offset+n_bytes > mapping->size()) {
+    throw cgns_exception("make_mapped_node_value: the array does not fit in the mapped region");
+  }
+  return dispatch_on_data_type(
+    data_type,
+    [&]<class T>(T) -> node_value {
+      if ((reinterpret_cast<std::uintptr_t>(mapping->data())+byte_offset) % alignof(T) != 0) {
+        throw cgns_exception("make_mapped_node_value: array of type "+to_string<T>()+" not aligned in the mapped region");
+      }
+      return node_value(mapped_array<T>(std::move(mapping),byte_offset,n),std::move(dims));
+    }
+  );
+}
+// make_mapped_node_value }
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,90 @@
+#pragma once
+
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "cpp_cgns/base/node_value.hpp"
+
+
+namespace cgns {
+
+
+// file_mapping {
+enum class mapping_mode {
+  read_only,    // the mapped memory must not be written to
+  copy_on_write // writes are private to the process: the file is never modified
+};
+
+/// region of a file mapped into memory
+/// pages are only read from the file when they are first accessed
+class file_mapping {
+  public:
+    /// maps `length` bytes of the file starting at `offset`
+    /// if `length` is negative, maps up to the end of the file
+    file_mapping(const std::string& file_name, mapping_mode mode = mapping_mode::read_only, I8 offset = 0, I8 length = -1);
+    ~file_mapping();
+
+    file_mapping(const file_mapping&) = delete;
+    file_mapping& operator=(const file_mapping&) = delete;
+
+    auto data()       ->       std::byte* { return data_; }
+    auto data() const -> const std::byte* { return data_; }
+    auto size() const -> I8 { return size_; }
+    auto mode() const -> mapping_mode { return mode_; }
+  private:
+    void* map_start; // mmap requires the start to be aligned on a page...
+    size_t map_size;
+    std::byte* data_; // ...so the requested region may start after it
+    I8 size_;
+    mapping_mode mode_;
+};
+
+auto map_file(const std::string& file_name, mapping_mode mode = mapping_mode::read_only, I8 offset = 0, I8 length = -1) -> std::shared_ptr<file_mapping>;
+// file_mapping }
+
+
+// mapped_array {
+/// contiguous range of `T` in a file_mapping
+/// the mapping stays alive as long as one of its arrays does
+template<class T>
+class mapped_array {
+  public:
+    using value_type = T;
+
+    mapped_array() = default;
+    mapped_array(std::shared_ptr<file_mapping> mapping, I8 byte_offset, I8 n)
+      : mapping(std::move(mapping))
+      , ptr(reinterpret_cast<T*>(this->mapping->data()+byte_offset))
+      , n(n)
+    {}
+
+    auto data()       ->       T* { return ptr; }
+    auto data() const -> const T* { return ptr; }
+    auto size() const -> size_t { return n; }
+
+    auto begin()       ->       T* { return ptr; }
+    auto begin() const -> const T* { return ptr; }
+    auto end()         ->       T* { return ptr+n; }
+    auto end()   const -> const T* { return ptr+n; }
+
+    auto operator[](I8 i)       ->       T& { return ptr[i]; }
+    auto operator[](I8 i) const -> const T& { return ptr[i]; }
+  private:
+    std::shared_ptr<file_mapping> mapping;
+    T* ptr = nullptr;
+    I8 n = 0;
+};
+// mapped_array }
+
+
+// [Sphinx Doc] mapped node_value {
+/// node_value whose memory is the region of `mapping` starting at `byte_offset`
+/// no data is copied: the node_value shares the ownership of the mapping
+/// if the mapping is `read_only`, the node_value must not be modified
+auto make_mapped_node_value(std::shared_ptr<file_mapping> mapping, data_type_id data_type, I8 byte_offset, std::vector<I8> dims) -> node_value;
+// [Sphinx Doc] mapped node_value }
+
+
+} // cgns
@@ -0,0 +1,144 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/flat_tree.hpp"
+
+
+#include <algorithm>
+
+
+namespace cgns {
+
+
+// construction {
+auto flat_tree::
+push_back(node_name name, node_label label, node_value value, index_type parent) -> index_type {
+  index_type i = size();
+  names_        .push_back(std::move(name));
+  labels_       .push_back(std::move(label));
+  values_       .push_back(std::move(value));
+  parents_      .push_back(parent);
+  subtree_sizes_.push_back(1);
+  return i;
+}
+auto flat_tree::
+reserve(index_type n) -> void {
+  names_        .reserve(n);
+  labels_       .reserve(n);
+  values_       .reserve(n);
+  parents_      .reserve(n);
+  subtree_sizes_.reserve(n);
+}
+// construction }
+
+
+// conversions {
+namespace {
+
+auto
+number_of_nodes(const tree& t) -> flat_tree::index_type {
+  flat_tree::index_type n = 1;
+  for (const tree& c : children(t)) {
+    n += number_of_nodes(c);
+  }
+  return n;
+}
+
+/// appends `t` and its descendants in preorder
+/// `Tree` is either `tree` or `const tree`
+/// `transfer_value` converts the value of a node of `t` into the value of the flat_tree node
+template<class Tree, class F> auto
+append_preorder(flat_tree& ft, Tree& t, flat_tree::index_type parent, F transfer_value) -> void {
+  auto i = ft.push_back(name(t),label(t),transfer_value(value_of_same_constness(t)),parent);
+  for (Tree& c : children(t)) {
+    append_preorder(ft,c,i,transfer_value);
+  }
+  ft.set_subtree_size(i,ft.size()-i);
+}
+
+template<class Tree, class F> auto
+to_flat_tree_impl(Tree& t, F transfer_value) -> flat_tree {
+  flat_tree ft;
+  ft.reserve(number_of_nodes(t));
+  append_preorder(ft,t,-1,transfer_value);
+  return ft;
+}
+
+auto
+to_tree_impl(flat_tree& ft, flat_tree::index_type i) -> tree {
+  tree t(ft.name(i),ft.label(i),std::move(ft.value(i)));
+  for (auto c=i+1; c<i+ft.subtree_size(i); c+=ft.subtree_size(c)) {
+    emplace_child(t,to_tree_impl(ft,c));
+  }
+  return t;
+}
+
+} // anonymous
+
+auto
+to_flat_tree(tree&& t) -> flat_tree {
+  return to_flat_tree_impl(t,[](node_value& x){ return std::move(x); });
+}
+auto
+to_flat_tree(const tree& t) -> flat_tree {
+  return to_flat_tree_impl(t,[](const node_value& x){ return clone(x); });
+}
+auto
+view_as_flat_tree(tree& t) -> flat_tree {
+  auto view = [](node_value& x) -> node_value {
+    if (x.type_id()==data_type_id::MT) return MT();
+    return make_non_owning_node_value(x.type_id(),x.data(),x.extent());
+  };
+  return to_flat_tree_impl(t,view);
+}
+
+auto
+to_tree(flat_tree&& ft) -> tree {
+  if (ft.size()==0) return tree();
+  return to_tree_impl(ft,0);
+}
+// conversions }
+
+
+// comparisons {
+auto
+same_tree_structure(const flat_tree& x, const flat_tree& y) -> bool {
+  // same preorder + same subtree sizes <=> same structure
+  return x.subtree_sizes()==y.subtree_sizes()
+      && x.labels()==y.labels()
+      && x.names()==y.names();
+}
+
+auto
+operator==(const flat_tree& x, const flat_tree& y) -> bool {
+  if (!same_tree_structure(x,y)) return false;
+  for (flat_tree::index_type i=0; i<x.size(); ++i) {
+    if (x.value(i)!=y.value(i)) return false;
+  }
+  return true;
+}
+// comparisons }
+
+
+// searches {
+auto
+find_indices_by_name(const flat_tree& ft, const node_name& name) -> std::vector<flat_tree::index_type> {
+  const auto& names = ft.names();
+  std::vector<flat_tree::index_type> res;
+  for (flat_tree::index_type i=0; i<ft.size(); ++i) {
+    if (names[i]==name) res.push_back(i);
+  }
+  return res;
+}
+auto
+find_indices_by_label(const flat_tree& ft, label_query label) -> std::vector<flat_tree::index_type> {
+  const auto& labels = ft.labels();
+  std::vector<flat_tree::index_type> res;
+  for (flat_tree::index_type i=0; i<ft.size(); ++i) {
+    if (label.matches(labels[i])) res.push_back(i);
+  }
+  return res;
+}
+// searches }
+
+
+} // cgns
+#endif // C++>17
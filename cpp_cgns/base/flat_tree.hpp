@@ -0,0 +1,103 @@
+#pragma once
+
+
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// A flat_tree stores the nodes of a tree in preorder, in contiguous arrays (struct-of-arrays)
+// A node is identified by its index i, and:
+//   - its first child, if any, is at index i+1
+//   - its next sibling, if any, is at index i+subtree_size(i)
+//   - its sub-tree is made of the nodes in [i,i+subtree_size(i))
+// Whole-tree scans are sequential memory walks, which is far more cache-friendly than following the children of a `tree`
+// A flat_tree is meant for read-only passes: its structure can't be modified (convert it back to a `tree` for that)
+class flat_tree {
+  public:
+    using index_type = I4;
+
+  // ctors
+    flat_tree() = default;
+    flat_tree(flat_tree&&) = default;
+    flat_tree& operator=(flat_tree&&) = default;
+    flat_tree(const flat_tree&) = delete;
+    flat_tree& operator=(const flat_tree&) = delete;
+
+  // size
+    auto
+    size() const -> index_type {
+      return names_.size();
+    }
+
+  // node access
+    auto name        (index_type i) const -> const node_name & { return names_[i];         }
+    auto label       (index_type i) const -> const node_label& { return labels_[i];        }
+    auto value       (index_type i)       ->       node_value& { return values_[i];        }
+    auto value       (index_type i) const -> const node_value& { return values_[i];        }
+    auto parent      (index_type i) const -> index_type        { return parents_[i];       } // -1 for the root
+    auto subtree_size(index_type i) const -> index_type        { return subtree_sizes_[i]; }
+
+    auto
+    number_of_children(index_type i) const -> int {
+      int n = 0;
+      for (index_type c=i+1; c<i+subtree_size(i); c+=subtree_size(c)) ++n;
+      return n;
+    }
+
+  // whole arrays
+    auto names        () const -> const std::vector<node_name >& { return names_;         }
+    auto labels       () const -> const std::vector<node_label>& { return labels_;        }
+    auto parents      () const -> const std::vector<index_type>& { return parents_;       }
+    auto subtree_sizes() const -> const std::vector<index_type>& { return subtree_sizes_; }
+    auto values       ()       ->       std::vector<node_value>& { return values_;        }
+    auto values       () const -> const std::vector<node_value>& { return values_;        }
+
+  // construction
+    /// appends a node and returns its index
+    /// its subtree size is initialized to 1 and must be updated once its descendants are appended
+    auto push_back(node_name name, node_label label, node_value value, index_type parent) -> index_type;
+    auto set_subtree_size(index_type i, index_type sz) -> void { subtree_sizes_[i] = sz; }
+    auto reserve(index_type n) -> void;
+  private:
+    std::vector<node_name > names_;
+    std::vector<node_label> labels_;
+    std::vector<index_type> parents_;
+    std::vector<index_type> subtree_sizes_;
+    std::vector<node_value> values_;
+};
+
+
+// [Sphinx Doc] flat_tree {
+// conversions
+auto to_flat_tree(tree&& t) -> flat_tree; // the node values are moved
+auto to_flat_tree(const tree& t) -> flat_tree; // the node values are copied
+auto view_as_flat_tree(tree& t) -> flat_tree; // the node values are non-owning views of the values of `t`
+auto to_tree(flat_tree&& ft) -> tree;
+
+// comparisons
+auto same_tree_structure(const flat_tree& x, const flat_tree& y) -> bool;
+auto operator==(const flat_tree& x, const flat_tree& y) -> bool;
+
+// searches
+template<class Unary_pred> auto find_indices_by_predicate(const flat_tree& ft, Unary_pred p) -> std::vector<flat_tree::index_type>;
+auto find_indices_by_name (const flat_tree& ft, const node_name& name) -> std::vector<flat_tree::index_type>;
+auto find_indices_by_label(const flat_tree& ft, label_query label)     -> std::vector<flat_tree::index_type>;
+// [Sphinx Doc] flat_tree }
+
+
+// ====================== impl ======================
+/// `p` is called as `p(ft,i)`
+template<class Unary_pred> auto
+find_indices_by_predicate(const flat_tree& ft, Unary_pred p) -> std::vector<flat_tree::index_type> {
+  std::vector<flat_tree::index_type> res;
+  for (flat_tree::index_type i=0; i<ft.size(); ++i) {
+    if (p(ft,i)) res.push_back(i);
+  }
+  return res;
+}
+
+
+} // cgns
@@ -0,0 +1,58 @@
+#pragma once
+
+
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+
+namespace cgns {
+
+
+// 64-bit non-cryptographic hash of a memory region (MurmurHash64A)
+// Processes 8 bytes at a time, so it is suited both for short strings and big arrays
+inline auto
+hash_bytes(const void* data, size_t len, std::uint64_t seed = 0) -> std::uint64_t {
+  constexpr std::uint64_t m = 0xc6a4a7935bd1e995ULL;
+  constexpr int r = 47;
+
+  std::uint64_t h = seed ^ (len * m);
+
+  const unsigned char* p = static_cast<const unsigned char*>(data);
+  size_t n_block = len/8;
+  for (size_t i=0; i<n_block; ++i) {
+    std::uint64_t k;
+    std::memcpy(&k,p+8*i,8);
+    k *= m;
+    k ^= k >> r;
+    k *= m;
+    h ^= k;
+    h *= m;
+  }
+
+  const unsigned char* tail = p + 8*n_block;
+  switch (len & 7) {
+    case 7: h ^= std::uint64_t(tail[6]) << 48; [[fallthrough]];
+    case 6: h ^= std::uint64_t(tail[5]) << 40; [[fallthrough]];
+    case 5: h ^= std::uint64_t(tail[4]) << 32; [[fallthrough]];
+    case 4: h ^= std::uint64_t(tail[3]) << 24; [[fallthrough]];
+    case 3: h ^= std::uint64_t(tail[2]) << 16; [[fallthrough]];
+    case 2: h ^= std::uint64_t(tail[1]) << 8 ; [[fallthrough]];
+    case 1: h ^= std::uint64_t(tail[0])      ;
+            h *= m;
+  }
+
+  h ^= h >> r;
+  h *= m;
+  h ^= h >> r;
+  return h;
+}
+
+// combine two hashes (order-dependent)
+constexpr auto
+hash_combine(std::uint64_t h, std::uint64_t x) -> std::uint64_t {
+  return h ^ (x + 0x9e3779b97f4a7c15ULL + (h << 12) + (h >> 4));
+}
+
+
+} // cgns
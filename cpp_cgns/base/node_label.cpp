@@ -0,0 +1,113 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/node_label.hpp"
+
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <ostream>
+
+
+namespace cgns {
+
+
+// intern table {
+namespace {
+
+class label_intern_table {
+  public:
+    label_intern_table() {
+      for (std::string_view s : cgns_label_names) {
+        insert(s);
+      }
+      insert(""); // empty_label_id
+    }
+
+    auto
+    find_or_insert(std::string_view s) -> node_label::id_type {
+      {
+        std::shared_lock lock(mut);
+        auto it = ids.find(s);
+        if (it != ids.end()) return it->second;
+      }
+      std::unique_lock lock(mut);
+      auto it = ids.find(s); // another thread may have inserted `s` in-between
+      if (it != ids.end()) return it->second;
+      return insert(s);
+    }
+
+    auto
+    find(std::string_view s) -> std::optional<node_label::id_type> {
+      std::shared_lock lock(mut);
+      auto it = ids.find(s);
+      if (it == ids.end()) return {};
+      return it->second;
+    }
+
+    auto
+    string(node_label::id_type id) -> std::string_view {
+      std::shared_lock lock(mut);
+      return strings[id];
+    }
+  private:
+    auto
+    insert(std::string_view s) -> node_label::id_type {
+      node_label::id_type id = strings.size();
+      const std::string& stored = strings.emplace_back(s); // std::deque: no reallocation, so `ids` keys stay valid
+      ids.emplace(stored,id);
+      return id;
+    }
+
+    std::shared_mutex mut;
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view,node_label::id_type> ids;
+};
+
+auto
+intern_table() -> label_intern_table& {
+  static label_intern_table t;
+  return t;
+}
+
+} // anonymous
+// intern table }
+
+
+auto
+node_label::intern(std::string_view s) -> id_type {
+  return intern_table().find_or_insert(s);
+}
+auto
+node_label::interned_string(id_type id) -> std::string_view {
+  return intern_table().string(id);
+}
+auto
+node_label::find(std::string_view s) -> std::optional<node_label> {
+  auto id = intern_table().find(s);
+  if (!id) return {};
+  return node_label(*id,0);
+}
+
+auto
+find_labels(const std::vector<std::string>& labels) -> std::vector<node_label> {
+  std::vector<node_label> res;
+  for (const std::string& s : labels) {
+    if (auto l = node_label::find(s)) res.push_back(*l);
+  }
+  return res;
+}
+
+
+auto
+to_string(const node_label& l) -> std::string {
+  return std::string(l.str());
+}
+auto
+operator<<(std::ostream& os, const node_label& l) -> std::ostream& {
+  return os << l.str();
+}
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,160 @@
+#pragma once
+
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <iosfwd>
+#include "cpp_cgns/sids/labels.hpp"
+
+
+namespace cgns {
+
+
+// A node_label is an interned string: it only stores an integer id
+//   - SIDS labels (see `cgns_label`) have a fixed id, equal to their enum value
+//   - other labels are registered in a global intern table the first time they are encountered
+// Hence comparing two labels is O(1)
+// The intern table never shrinks: searches should use `node_label::find` rather than constructing a label,
+// since a string that was never interned can't be the label of any node
+class node_label {
+  public:
+    using id_type = std::int32_t;
+    static constexpr id_type empty_label_id = n_cgns_label; // id of "", the label of a default-constructed node
+
+  // ctors
+    constexpr
+    node_label()
+      : id_(empty_label_id)
+    {}
+
+    constexpr
+    node_label(cgns_label l)
+      : id_(id_type(l))
+    {}
+
+    node_label(const char* s)
+      : id_(intern(s))
+    {}
+    node_label(const std::string& s)
+      : id_(intern(s))
+    {}
+    explicit
+    node_label(std::string_view s)
+      : id_(intern(s))
+    {}
+
+  // lookup without interning
+    /// the label of string `s` if it was interned, else nothing
+    static auto find(std::string_view s) -> std::optional<node_label>;
+
+  // access
+    constexpr auto
+    id() const -> id_type {
+      return id_;
+    }
+    constexpr auto
+    is_sids_label() const -> bool {
+      return id_ < n_cgns_label;
+    }
+
+    auto
+    str() const -> std::string_view {
+      if (is_sids_label()) return cgns_label_names[id_];
+      return interned_string(id_);
+    }
+    operator std::string_view() const {
+      return str();
+    }
+    operator std::string() const {
+      return std::string(str());
+    }
+
+  // comparisons
+    friend constexpr auto
+    operator==(const node_label& x, const node_label& y) -> bool {
+      return x.id_ == y.id_;
+    }
+    friend constexpr auto
+    operator==(const node_label& x, cgns_label y) -> bool {
+      return x.id_ == id_type(y);
+    }
+    /// compare the strings rather than interning the argument
+    friend auto
+    operator==(const node_label& x, const char* y) -> bool {
+      return x.str() == y;
+    }
+    friend auto
+    operator==(const node_label& x, const std::string& y) -> bool {
+      return x.str() == y;
+    }
+  private:
+    constexpr explicit
+    node_label(id_type id, int)
+      : id_(id)
+    {}
+
+    static auto intern(std::string_view s) -> id_type;
+    static auto interned_string(id_type id) -> std::string_view;
+
+    id_type id_;
+};
+
+
+// A label to search for
+// It is given either as a node_label, or as a string that is only looked up (never interned):
+// a string that is not a known label can't be the label of any node, so the query matches nothing
+class label_query {
+  public:
+    label_query(node_label l)
+      : label_(l)
+      , str_(l.str())
+    {}
+    label_query(cgns_label l)
+      : label_query(node_label(l))
+    {}
+    label_query(std::string_view s)
+      : label_(node_label::find(s))
+      , str_(s)
+    {}
+    label_query(const char* s)
+      : label_query(std::string_view(s))
+    {}
+    label_query(const std::string& s)
+      : label_query(std::string_view(s))
+    {}
+
+    auto
+    matches(const node_label& l) const -> bool {
+      return label_ && *label_==l;
+    }
+    /// for error messages (only valid while the string the query was built from is alive)
+    auto
+    str() const -> std::string_view {
+      return str_;
+    }
+  private:
+    std::optional<node_label> label_; // nothing if no node can have this label
+    std::string_view str_;
+};
+
+
+/// labels of the strings of `labels` that were interned (the other ones can't match any node)
+auto find_labels(const std::vector<std::string>& labels) -> std::vector<node_label>;
+
+auto to_string(const node_label& l) -> std::string;
+auto operator<<(std::ostream& os, const node_label& l) -> std::ostream&;
+
+
+} // cgns
+
+
+template<>
+struct std::hash<cgns::node_label> {
+  auto
+  operator()(const cgns::node_label& l) const -> size_t {
+    return std::hash<cgns::node_label::id_type>{}(l.id());
+  }
+};
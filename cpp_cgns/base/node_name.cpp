@@ -0,0 +1,40 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/node_name.hpp"
+
+
+#include <algorithm>
+#include <ostream>
+#include "cpp_cgns/base/exception.hpp"
+
+
+namespace cgns {
+
+
+node_name::
+node_name(std::string_view s)
+  : chars_{}
+  , size_(s.size())
+  , hash_(hash_of(s))
+{
+  if (s.size() > max_size) {
+    throw cgns_exception(
+      "CGNS node names are limited to "+std::to_string(max_size)+" characters, "
+      "but \""+std::string(s)+"\" is "+std::to_string(s.size())+" characters long"
+    );
+  }
+  std::copy(s.begin(),s.end(),chars_.begin());
+}
+
+
+auto
+to_string(const node_name& n) -> std::string {
+  return std::string(n.str());
+}
+auto
+operator<<(std::ostream& os, const node_name& n) -> std::ostream& {
+  return os << n.str();
+}
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,159 @@
+#pragma once
+
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <iosfwd>
+#include "cpp_cgns/base/hash.hpp"
+
+
+namespace cgns {
+
+
+// node name assignments {
+// Assigning a node_name happens when a node is renamed (`name(t) = ...`) or when a whole tree is assigned (`t = std::move(other)`)
+// These assignments are counted, so that the name index of the children of a node can tell that it may be stale (see `tree_children`)
+inline std::atomic<std::uint64_t> name_assignment_count = 0;
+
+// Assignments done in the scope of an `untracked_name_assignments` object (on the same thread) are not counted
+// It is meant for code that moves children around, then updates (or invalidates) the name index of their parent itself
+inline thread_local int untracked_name_assignment_scopes = 0;
+
+class untracked_name_assignments {
+  public:
+    untracked_name_assignments() { ++untracked_name_assignment_scopes; }
+    ~untracked_name_assignments() { --untracked_name_assignment_scopes; }
+    untracked_name_assignments(const untracked_name_assignments&) = delete;
+    untracked_name_assignments& operator=(const untracked_name_assignments&) = delete;
+};
+// node name assignments }
+
+
+// A node_name stores its characters inline, since CGNS names are at most 32 characters long
+// Its length and hash are computed once at construction, so that
+//   - there is no heap allocation
+//   - comparing two names is a hash comparison, then a single 32-byte comparison
+// Constructing a node_name from a string longer than 32 characters is an error (throws a cgns_exception)
+class node_name {
+  public:
+    static constexpr int max_size = 32;
+
+  // ctors
+    node_name()
+      : chars_{}
+      , size_(0)
+      , hash_(hash_of(""))
+    {}
+
+    node_name(const char* s)
+      : node_name(std::string_view(s))
+    {}
+    node_name(const std::string& s)
+      : node_name(std::string_view(s))
+    {}
+    explicit
+    node_name(std::string_view s);
+
+  // copy
+    node_name(const node_name&) = default;
+    auto
+    operator=(const node_name& x) -> node_name& {
+      chars_ = x.chars_;
+      size_ = x.size_;
+      hash_ = x.hash_;
+      if (untracked_name_assignment_scopes==0) {
+        name_assignment_count.fetch_add(1,std::memory_order_relaxed);
+      }
+      return *this;
+    }
+
+  // access
+    auto
+    size() const -> int {
+      return size_;
+    }
+    auto
+    empty() const -> bool {
+      return size_==0;
+    }
+    auto
+    data() const -> const char* {
+      return chars_.data();
+    }
+    auto
+    hash() const -> std::uint32_t {
+      return hash_;
+    }
+
+    auto
+    str() const -> std::string_view {
+      return std::string_view(chars_.data(),size_);
+    }
+    operator std::string_view() const {
+      return str();
+    }
+    operator std::string() const {
+      return std::string(str());
+    }
+
+  // comparisons
+    friend auto
+    operator==(const node_name& x, const node_name& y) -> bool {
+      // chars_ are zero-padded: comparing the whole arrays is equivalent to comparing the strings
+      return x.hash_==y.hash_ && x.size_==y.size_ && x.chars_==y.chars_;
+    }
+    friend auto
+    operator==(const node_name& x, const char* y) -> bool {
+      return x.str() == y;
+    }
+    friend auto
+    operator==(const node_name& x, const std::string& y) -> bool {
+      return x.str() == y;
+    }
+    friend auto
+    operator<(const node_name& x, const node_name& y) -> bool {
+      return x.str() < y.str();
+    }
+
+  // concatenation (mainly for error messages)
+    friend auto operator+(const std::string& x, const node_name& y) -> std::string { return x + std::string(y.str()); }
+    friend auto operator+(const node_name& x, const std::string& y) -> std::string { return std::string(x.str()) + y; }
+    friend auto operator+(const char*        x, const node_name& y) -> std::string { return x + std::string(y.str()); }
+    friend auto operator+(const node_name& x, const char*        y) -> std::string { return std::string(x.str()) + y; }
+  private:
+    static auto
+    hash_of(std::string_view s) -> std::uint32_t {
+      return std::uint32_t(hash_bytes(s.data(),s.size()));
+    }
+
+    std::array<char,max_size> chars_;
+    std::uint8_t size_;
+    std::uint32_t hash_;
+};
+
+
+/// name to search for: nothing if `s` is too long to be a node name (no node can have this name)
+inline auto
+as_name_query(std::string_view s) -> std::optional<node_name> {
+  if (s.size() > size_t(node_name::max_size)) return {};
+  return node_name(s);
+}
+
+auto to_string(const node_name& n) -> std::string;
+auto operator<<(std::ostream& os, const node_name& n) -> std::ostream&;
+
+
+} // cgns
+
+
+template<>
+struct std::hash<cgns::node_name> {
+  auto
+  operator()(const cgns::node_name& n) const -> size_t {
+    return n.hash();
+  }
+};
@@ -6,6 +6,7 @@
 #include "std_e/multi_array/utils.hpp"
 #include "cpp_cgns/base/node_value_conversion.hpp"
 #include "cpp_cgns/dispatch.hpp"
+#include "cpp_cgns/base/allocation_policy.hpp"
 
 
 namespace cgns {
@@ -25,29 +26,22 @@ auto dims_to_string(const std::vector<I8>& dims) -> std::string {
 auto to_complete_string(const node_value& x) -> std::string {
   return
     dispatch_on_data_type(
-      x.data_type(),
+      x.type_id(),
       [&x]<class T>(T){ return to_string(view_as_md_array<T,dyn_rank>(x)); }
     );
 }
 
 auto to_string(const node_value& x, int threshold) -> std::string {
-  if (x.data_type()=="MT") return "MT";
-  if (x.data_type()=="C1") return std::string((const char*)x.data(),x.extent(0));
-  if (std_e::cartesian_product_size(x.extent())<=threshold) return x.data_type()+to_complete_string(x);
-  else return x.data_type()+"{"+dims_to_string(x.extent())+"}";
+  data_type_id id = x.type_id();
+  if (id==data_type_id::MT) return "MT";
+  if (id==data_type_id::C1) return std::string((const char*)x.data(),x.extent(0));
+  if (std_e::cartesian_product_size(x.extent())<=threshold) return to_string(id)+to_complete_string(x);
+  else return to_string(id)+"{"+dims_to_string(x.extent())+"}";
 }
 // to_string }
 
 
 // make_node_value {
-constexpr auto
-make_node_value_impl = []<class T>(T, const void* data, std::vector<I8> dims) -> node_value {
-  auto sz = std_e::cartesian_product_size(dims);
-  auto* ptr = static_cast<const T*>(data);
-  std::vector<T> rng(ptr,ptr+sz);
-  return node_value(md_array<T,dyn_rank>(std::move(rng),md_array_shape<dyn_rank>(std::move(dims))));
-};
-
 constexpr auto
 make_non_owning_node_value_impl = []<class T>(T, void* data, std::vector<I8> dims) -> node_value {
   auto sz = std_e::cartesian_product_size(dims);
@@ -57,16 +51,11 @@ make_non_owning_node_value_impl = []<class T>(T, void* data, std::vector<I8> dim
 };
 
 auto
-make_node_value(const std::string& data_type, const void* data, std::vector<I8> dims) -> node_value {
-  return
-    dispatch_on_data_type(
-      data_type,
-      make_node_value_impl,
-        data,
-        std::move(dims));
+make_node_value(data_type_id data_type, const void* data, std::vector<I8> dims) -> node_value {
+  return make_node_value(data_type,data,std::move(dims),default_allocation_policy());
 }
 auto
-make_non_owning_node_value(const std::string& data_type, void* data, std::vector<I8> dims) -> node_value {
+make_non_owning_node_value(data_type_id data_type, void* data, std::vector<I8> dims) -> node_value {
   return
     dispatch_on_data_type(
       data_type,
@@ -74,7 +63,24 @@ make_non_owning_node_value(const std::string& data_type, void* data, std::vector
         data,
         std::move(dims));
 }
+auto
+make_node_value(const std::string& data_type, const void* data, std::vector<I8> dims) -> node_value {
+  return make_node_value(to_data_type_id(data_type),data,std::move(dims));
+}
+auto
+make_non_owning_node_value(const std::string& data_type, void* data, std::vector<I8> dims) -> node_value {
+  return make_non_owning_node_value(to_data_type_id(data_type),data,std::move(dims));
+}
 // make_node_value }
 
+
+// clone {
+auto
+clone(const node_value& x) -> node_value {
+  if (x.type_id()==data_type_id::MT) return MT();
+  return make_node_value(x.type_id(),x.data(),x.extent());
+}
+// clone }
+
 } // cgns
 #endif // C++>17
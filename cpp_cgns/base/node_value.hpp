@@ -124,11 +124,17 @@ class node_value : public node_value_impl {
       requires is_data_type<T>
         friend auto
     holds_alternative(const node_value& x) -> bool;
+    /// constant time, no allocation: to be used for tests and dispatch
     auto
-    data_type() const -> std::string {
+    type_id() const -> data_type_id {
       const auto& rng = underlying_range();
-      if (std_e::holds_alternative<C1>(rng) && std_e::get<C1>(rng).is_null()) return "MT";
-      return this->visit([]<class T>(const std_e::polymorphic_array<T>&){ return to_string<T>(); });
+      if (std_e::holds_alternative<C1>(rng) && std_e::get<C1>(rng).is_null()) return data_type_id::MT;
+      return this->visit([]<class T>(const std_e::polymorphic_array<T>&){ return type_id_of<T>; });
+    }
+    /// string form, for I/O and messages
+    auto
+    data_type() const -> std::string {
+      return to_string(type_id());
     }
 
     template<class F> auto
@@ -171,6 +177,15 @@ holds_alternative(const node_value& x) -> bool {
 }
 
 // comparison {
+inline auto
+same_shape(const node_value& x, const node_value& y) -> bool {
+  if (x.rank()!=y.rank()) return false;
+  for (int i=0; i<(int)x.rank(); ++i) {
+    if (x.extent(i)!=y.extent(i)) return false;
+  }
+  return true;
+}
+
 template<class T> auto
 operator==(const node_value& x, const std_e::span<T>& y) -> bool {
   if (x.rank()!=1) return false;
@@ -227,11 +242,20 @@ MT() -> node_value {
 
 
 /// ptr -> node_value {
+/// `make_node_value` copies the data into an array allocated with the default allocation_policy (see allocation_policy.hpp)
+auto make_node_value(data_type_id data_type, const void* data, std::vector<I8> dims) -> node_value;
+auto make_non_owning_node_value(data_type_id data_type, void* data, std::vector<I8> dims) -> node_value;
 auto make_node_value(const std::string& data_type, const void* data, std::vector<I8> dims) -> node_value;
 auto make_non_owning_node_value(const std::string& data_type, void* data, std::vector<I8> dims) -> node_value;
 /// ptr -> node_value }
 
 
+/// deep copy {
+// node_value is not copyable, to prevent accidental copies of big arrays: the copy has to be explicit
+auto clone(const node_value& x) -> node_value;
+/// deep copy }
+
+
 /// to_string {
 inline constexpr int default_threshold_to_print_whole_array = 10;
 auto to_string(const node_value& x, int threshold = default_threshold_to_print_whole_array) -> std::string;
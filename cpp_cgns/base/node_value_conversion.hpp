@@ -23,7 +23,7 @@ template<class T, int rank = 1, class Node_value> auto view_as_array(Node_value&
 /// node_value -> span {
 template<class T, class Node_value> auto
 view_as_span(Node_value& x) {
-  STD_E_ASSERT(x.data_type()==to_string<T>());
+  STD_E_ASSERT(x.type_id()==type_id_of<T>);
   STD_E_ASSERT(std_e::is_one_dimensional(x.extent()));
   return std_e::make_span(data_as<T>(x), x.size());
 }
@@ -33,7 +33,7 @@ view_as_span(Node_value& x) {
 /// node_value -> md_array_view<T> {
 template<class T, int rank, class Node_value> auto
 view_as_md_array(Node_value& x, std::vector<I8> dims) {
-  STD_E_ASSERT(x.data_type()==to_string<T>());
+  STD_E_ASSERT(x.type_id()==type_id_of<T>);
   STD_E_ASSERT(rank==dyn_rank || int(x.rank())==rank);
   STD_E_ASSERT(x.size()==std_e::cartesian_product_size(dims));
   std_e::dyn_shape<I8,rank> shape{std::move(dims)};
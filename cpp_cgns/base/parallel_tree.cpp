@@ -0,0 +1,142 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/parallel_tree.hpp"
+
+
+#include "cpp_cgns/dispatch.hpp"
+
+
+namespace cgns {
+
+
+auto
+default_number_of_threads() -> int {
+  return std::max(1u,std::thread::hardware_concurrency());
+}
+
+
+// node_value {
+namespace {
+  // under this number of elements, arrays are compared serially
+  constexpr I8 parallel_value_threshold = 1 << 20;
+  constexpr I8 value_chunk_size = 1 << 18;
+}
+
+auto
+parallel_equal(const node_value& x, const node_value& y, int n_threads) -> bool {
+  data_type_id data_type = x.type_id();
+  if (data_type!=y.type_id() || !same_shape(x,y)) return false;
+  if (data_type==data_type_id::MT || (I8)x.size() < parallel_value_threshold || n_threads<=1) return x==y;
+
+  return dispatch_on_data_type(
+    data_type,
+    [&]<class T>(T){
+      const T* x_data = data_as<T>(x);
+      const T* y_data = data_as<T>(y);
+      I8 n = x.size();
+      int n_chunks = (n+value_chunk_size-1)/value_chunk_size;
+
+      std::atomic<bool> is_equal = true;
+      run_tasks(n_chunks,n_threads,[&](int c){
+        if (!is_equal.load(std::memory_order_relaxed)) return; // a difference was already found
+        I8 start = c*value_chunk_size;
+        I8 finish = std::min(start+value_chunk_size,n);
+        if (!std::equal(x_data+start,x_data+finish,y_data+start)) {
+          is_equal = false;
+        }
+      });
+      return is_equal.load();
+    }
+  );
+}
+// node_value }
+
+
+// tree comparisons {
+namespace {
+
+struct node_pair {
+  const tree* x;
+  const tree* y;
+};
+
+template<class Same_node> auto
+same_subtree(const tree& x, const tree& y, Same_node& same_node) -> bool {
+  if (!same_node(x,y)) return false;
+  if (number_of_children(x)!=number_of_children(y)) return false;
+  const auto& xcs = children(x);
+  const auto& ycs = children(y);
+  for (size_t i=0; i<xcs.size(); ++i) {
+    if (!same_subtree(xcs[i],ycs[i],same_node)) return false;
+  }
+  return true;
+}
+
+/// `same_node` is called concurrently, so it must be thread-safe
+template<class Same_node> auto
+parallel_zip_compare(const tree& x, const tree& y, int n_threads, Same_node same_node) -> bool {
+  // expand the zipped trees breadth-first until there are enough sub-tree pairs
+  std::vector<node_pair> subtrees = {{&x,&y}};
+  while ((int)subtrees.size() < tasks_per_thread*n_threads) {
+    std::vector<node_pair> next;
+    bool expanded = false;
+    for (auto [a,b] : subtrees) {
+      if (number_of_children(*a)==0) {
+        next.push_back({a,b});
+      } else {
+        if (!same_node(*a,*b) || number_of_children(*a)!=number_of_children(*b)) return false;
+        const auto& acs = children(*a);
+        const auto& bcs = children(*b);
+        for (size_t i=0; i<acs.size(); ++i) {
+          next.push_back({&acs[i],&bcs[i]});
+        }
+        expanded = true;
+      }
+    }
+    subtrees = std::move(next);
+    if (!expanded) break;
+  }
+
+  std::atomic<bool> is_same = true;
+  run_tasks(subtrees.size(),n_threads,[&](int i){
+    if (!is_same.load(std::memory_order_relaxed)) return; // a difference was already found
+    if (!same_subtree(*subtrees[i].x,*subtrees[i].y,same_node)) {
+      is_same = false;
+    }
+  });
+  return is_same.load();
+}
+
+} // anonymous
+
+auto
+parallel_same_tree_structure(const tree& x, const tree& y, int n_threads) -> bool {
+  auto same_node = [](const tree& a, const tree& b){ return name(a)==name(b) && label(a)==label(b); };
+  return parallel_zip_compare(x,y,n_threads,same_node);
+}
+
+auto
+parallel_equal(const tree& x, const tree& y, int n_threads) -> bool {
+  // big values are not compared during the traversal, but afterwards, each one with all the threads
+  std::vector<node_pair> big_values;
+  std::mutex big_values_mutex;
+  auto same_node = [&](const tree& a, const tree& b){
+    if (name(a)!=name(b) || label(a)!=label(b)) return false;
+    if ((I8)value(a).size() >= parallel_value_threshold) {
+      std::lock_guard lock(big_values_mutex);
+      big_values.push_back({&a,&b});
+      return true;
+    }
+    return value(a)==value(b);
+  };
+  if (!parallel_zip_compare(x,y,n_threads,same_node)) return false;
+
+  for (auto [a,b] : big_values) {
+    if (!parallel_equal(value(*a),value(*b),n_threads)) return false;
+  }
+  return true;
+}
+// tree comparisons }
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,111 @@
+#pragma once
+
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// Multi-threaded algorithms over trees
+// The tree is split into enough sub-trees to keep all the threads busy,
+// then the threads pick the sub-trees one after the other (dynamic scheduling), so that unbalanced trees are handled well
+
+auto default_number_of_threads() -> int;
+
+// [Sphinx Doc] parallel tree algorithms {
+/// calls `f` on each node, in no particular order (`f` must be thread-safe)
+template<class Tree, class F> auto
+parallel_for_each_node(Tree& t, F f, int n_threads = default_number_of_threads()) -> void;
+
+auto parallel_same_tree_structure(const tree& x, const tree& y, int n_threads = default_number_of_threads()) -> bool;
+auto parallel_equal(const tree& x, const tree& y, int n_threads = default_number_of_threads()) -> bool;
+/// big arrays are compared by chunks
+auto parallel_equal(const node_value& x, const node_value& y, int n_threads = default_number_of_threads()) -> bool;
+// [Sphinx Doc] parallel tree algorithms }
+
+
+// ====================== impl ======================
+/// calls `f(i)` for each i in [0,n_tasks), distributed over `n_threads` threads
+/// the tasks are attributed dynamically: each thread picks the next task when it is done with the previous one
+/// if a task throws, the remaining tasks are not started, and the exception is re-thrown
+template<class F> auto
+run_tasks(int n_tasks, int n_threads, F f) -> void {
+  n_threads = std::max(1,std::min(n_threads,n_tasks));
+  if (n_threads==1) {
+    for (int i=0; i<n_tasks; ++i) f(i);
+    return;
+  }
+
+  std::atomic<int> next_task = 0;
+  std::exception_ptr error = nullptr;
+  std::mutex error_mutex;
+  auto worker = [&](){
+    try {
+      for (int i=next_task++; i<n_tasks; i=next_task++) {
+        f(i);
+      }
+    } catch (...) {
+      std::lock_guard lock(error_mutex);
+      if (!error) error = std::current_exception();
+      next_task = n_tasks;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(n_threads-1);
+  for (int k=0; k<n_threads-1; ++k) {
+    threads.emplace_back(worker);
+  }
+  worker(); // the calling thread also works
+  for (auto& th : threads) {
+    th.join();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+
+/// number of sub-trees per thread: more tasks than threads for load balancing
+inline constexpr int tasks_per_thread = 4;
+
+template<class Tree, class F> auto
+for_each_node_serial(Tree& t, F& f) -> void {
+  f(t);
+  for (Tree& c : children(t)) {
+    for_each_node_serial(c,f);
+  }
+}
+
+template<class Tree, class F> auto
+parallel_for_each_node(Tree& t, F f, int n_threads) -> void {
+  // expand the tree breadth-first until there are enough sub-trees
+  std::vector<Tree*> subtrees = {&t};
+  while ((int)subtrees.size() < tasks_per_thread*n_threads) {
+    std::vector<Tree*> next;
+    bool expanded = false;
+    for (Tree* n : subtrees) {
+      if (number_of_children(*n)==0) {
+        next.push_back(n);
+      } else {
+        f(*n);
+        for (Tree& c : children(*n)) {
+          next.push_back(&c);
+        }
+        expanded = true;
+      }
+    }
+    subtrees = std::move(next);
+    if (!expanded) break;
+  }
+
+  run_tasks(subtrees.size(),n_threads,[&](int i){ for_each_node_serial(*subtrees[i],f); });
+}
+
+
+} // cgns
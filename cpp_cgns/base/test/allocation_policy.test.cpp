@@ -0,0 +1,93 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/allocation_policy.hpp"
+#include <cstdint>
+#include <numeric>
+
+using namespace cgns;
+
+namespace {
+  auto
+  is_aligned(const void* ptr, size_t alignment) -> bool {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+  }
+}
+
+TEST_CASE("allocation policy") {
+  std::vector<R8> v = {1.,2.,3.,4.,5.,6.};
+
+  SUBCASE("default") {
+    node_value x = make_node_value(data_type_id::R8,v.data(),{3,2});
+    CHECK( is_aligned(x.data(),64) );
+    CHECK( x == v );
+    CHECK( is_aligned(clone(x).data(),64) );
+  }
+
+  SUBCASE("explicit policy") {
+    // [Sphinx Doc] allocation_policy example {
+    allocation_policy policy;
+    policy.alignment = 256;
+    policy.first_touch_threads = 4;
+    node_value x = make_node_value(data_type_id::R8,v.data(),{6},policy);
+    // [Sphinx Doc] allocation_policy example }
+    CHECK( is_aligned(x.data(),256) );
+    CHECK( x == v );
+  }
+
+  SUBCASE("first touch copy") {
+    allocation_policy policy;
+    policy.first_touch_threads = 4;
+    copy_bytes(nullptr,0,nullptr,policy); // empty: nothing is dereferenced
+
+    std::vector<I4> small = {0,1,2};
+    std::vector<I4> small_copy(3);
+    copy_bytes(small.data(),3*sizeof(I4),small_copy.data(),policy); // too small to be worth threads
+    CHECK( small_copy == small );
+
+    std::vector<I4> big(4*4*huge_page_size/sizeof(I4)+3); // big enough for each thread to copy a few huge pages
+    std::iota(begin(big),end(big),0);
+    std::vector<I4> big_copy(big.size());
+    copy_bytes(big.data(),big.size()*sizeof(I4),big_copy.data(),policy);
+    CHECK( big_copy == big );
+  }
+
+  SUBCASE("huge pages") {
+    allocation_policy policy;
+    policy.huge_pages = true;
+    aligned_array<R8> big(huge_page_size/sizeof(R8),policy);
+    CHECK( is_aligned(big.data(),huge_page_size) );
+    aligned_array<R8> small(10,policy); // too small for huge pages
+    CHECK( is_aligned(small.data(),64) );
+  }
+
+  SUBCASE("global policy") {
+    allocation_policy policy;
+    policy.alignment = 4096;
+    {
+      allocation_policy_scope _(policy);
+      CHECK( default_allocation_policy().alignment == 4096 );
+      node_value x = make_node_value(data_type_id::R8,v.data(),{6});
+      CHECK( is_aligned(x.data(),4096) );
+    }
+    CHECK( default_allocation_policy().alignment == 64 );
+  }
+
+  SUBCASE("per tree") {
+    tree t = {"Base", "CGNSBase_t", node_value({3,3}), {
+      tree{"Z", "Zone_t", node_value(std::vector<R8>(v))}
+    }};
+    allocation_policy policy;
+    policy.alignment = 1024;
+    reallocate_values(t,policy);
+    CHECK( is_aligned(value(t).data(),1024) );
+    CHECK( is_aligned(value(child(t,0)).data(),1024) );
+    CHECK( value(child(t,0)) == v );
+  }
+
+  SUBCASE("invalid alignment") {
+    allocation_policy policy;
+    policy.alignment = 96;
+    CHECK_THROWS_AS( aligned_array<I4>(10,policy) , const cgns_exception& );
+  }
+}
+#endif // C++>17
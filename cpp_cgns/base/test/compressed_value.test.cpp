@@ -0,0 +1,98 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/compressed_value.hpp"
+#include "cpp_cgns/base/node_value_conversion.hpp"
+#include <limits>
+#include <numeric>
+
+using namespace cgns;
+
+TEST_CASE("compressed node_value") {
+  SUBCASE("sorted integers") {
+    std::vector<I8> offsets(1000);
+    std::iota(begin(offsets),end(offsets),I8(1'000'000'000'000));
+    node_value x(std::vector<I8>(offsets));
+
+    compressed_value cx = compress(x);
+    CHECK( cx.codec == value_codec::delta_varint );
+    CHECK( cx.bytes.size() < 1000*sizeof(I8)/4 );
+    CHECK( decompress(cx) == offsets );
+  }
+
+  SUBCASE("negative and extreme integers") {
+    std::vector<I4> v = {0,-1,std::numeric_limits<I4>::max(),std::numeric_limits<I4>::min(),42};
+    node_value x(std::vector<I4>(v));
+    CHECK( decompress(compress(x)) == v );
+  }
+
+  SUBCASE("floats") {
+    std::vector<R8> v(500,3.14);
+    v[100] = -2.5;
+    node_value x(std::vector<R8>(v));
+
+    compressed_value cx = compress(x);
+    CHECK( cx.codec == value_codec::xor_varint );
+    CHECK( cx.bytes.size() < 500*sizeof(R8)/4 );
+    CHECK( decompress(cx) == v );
+  }
+
+  SUBCASE("incompressible") {
+    node_value x("Alice & Bob");
+    compressed_value cx = compress(x);
+    CHECK( cx.codec == value_codec::raw );
+    CHECK( to_string(decompress(cx)) == "Alice & Bob" );
+  }
+
+  SUBCASE("multi-dimensional") {
+    node_value x({{1,2,3},{4,5,6}});
+    node_value y = decompress(compress(x));
+    CHECK( y.rank() == 2 );
+    CHECK( y.extent(1) == 3 );
+    CHECK( y(1,2) == 6 );
+  }
+
+  SUBCASE("lazy decompression") {
+    // [Sphinx Doc] compressed node_value example {
+    tree t = {"Elements", "Elements_t", MT(), {
+      tree{"ElementStartOffset", "DataArray_t", node_value(std::vector<I4>{0,3,6,9})},
+      tree{"ElementConnectivity", "DataArray_t", node_value(std::vector<I4>{0,1,2, 1,2,3, 2,3,4})}
+    }};
+    auto compressed = compress_values(t,[](const tree& n){ return label(n)=="DataArray_t"; });
+    CHECK( compressed.size() == 2 );
+
+    auto offsets = view_as_span<I4>(mutable_value(child(t,0))); // decompressed here
+    CHECK( offsets.size() == 4 );
+    CHECK( offsets[3] == 9 );
+    offsets[3] = 10;
+
+    // free the decompressed memory, while keeping the data (with its modifications) compressed
+    compressed[0] = recompress(mutable_value(child(t,0)));
+    // [Sphinx Doc] compressed node_value example }
+    CHECK( value(child(t,0)) == std::vector<I4>{0,3,6,10} );
+    CHECK( value(child(t,1)) == std::vector<I4>{0,1,2, 1,2,3, 2,3,4} );
+    CHECK( decompress(*compressed[0]) == std::vector<I4>{0,3,6,10} );
+  }
+  SUBCASE("lazy decompression - writes are not kept by the compressed value") {
+    auto cx = std::make_shared<const compressed_value>(compress(node_value({5,6,7})));
+    node_value x = make_lazy_node_value(cx);
+    data_as<I4>(x)[0] = 0;
+    CHECK( make_lazy_node_value(cx) == std::vector<I4>{5,6,7} );
+    recompress(x);
+    CHECK( x == std::vector<I4>{0,6,7} );
+  }
+
+  SUBCASE("lazy array") {
+    auto cx = std::make_shared<const compressed_value>(compress(node_value({5,6,7})));
+    lazy_decompressed_array<I4> a(cx);
+    CHECK( a.size() == 3 );
+    CHECK_FALSE( a.is_decompressed() );
+    CHECK( a[2] == 7 );
+    CHECK( a.is_decompressed() );
+    CHECK_THROWS_AS( lazy_decompressed_array<R8>(cx) , const cgns_exception& );
+  }
+
+  SUBCASE("empty") {
+    CHECK( decompress(compress(MT())) == MT() );
+  }
+}
+#endif // C++>17
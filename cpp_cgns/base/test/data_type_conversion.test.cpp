@@ -0,0 +1,93 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/data_type_conversion.hpp"
+#include <limits>
+
+using namespace cgns;
+
+TEST_CASE("data type conversion") {
+  SUBCASE("widening") {
+    node_value x({{1,2,3},{4,5,6}});
+    convert_data_type(x,data_type_id::I8);
+    CHECK( x.type_id() == data_type_id::I8 );
+    CHECK( x.rank() == 2 );
+    CHECK( x(1,2) == I8(6) );
+  }
+
+  SUBCASE("narrowing") {
+    std::vector<I8> v = {1,-2,3};
+
+    SUBCASE("in place") {
+      node_value x(std::vector<I8>(v));
+      const void* mem = x.data();
+      conversion_options opts;
+      opts.in_place_narrowing = true;
+      convert_data_type(x,data_type_id::I4,opts);
+      CHECK( x.type_id() == data_type_id::I4 );
+      CHECK( x.data() == mem );
+      CHECK( x == std::vector<I4>{1,-2,3} );
+    }
+    SUBCASE("new array") {
+      node_value x(std::vector<I8>(v));
+      convert_data_type(x,data_type_id::I4);
+      CHECK( x == std::vector<I4>{1,-2,3} );
+    }
+    SUBCASE("memory not owned by the value") {
+      node_value x = make_non_owning_node_value(data_type_id::I8,v.data(),{3});
+      convert_data_type(x,data_type_id::I4);
+      CHECK( x == std::vector<I4>{1,-2,3} );
+      CHECK( v == std::vector<I8>{1,-2,3} ); // not overwritten
+    }
+    SUBCASE("out of range") {
+      node_value x(std::vector<I8>{1,std::numeric_limits<I8>::max()});
+      CHECK_THROWS_AS( convert_data_type(x,data_type_id::I4) , const cgns_exception& );
+      CHECK( x.type_id() == data_type_id::I8 ); // unchanged
+      CHECK( x(1) == std::numeric_limits<I8>::max() );
+    }
+  }
+
+  SUBCASE("floating point") {
+    node_value x(std::vector<R4>{0.5f,1.5f});
+    convert_data_type(x,data_type_id::R8);
+    CHECK( x == std::vector<R8>{0.5,1.5} );
+    convert_data_type(x,data_type_id::R4);
+    CHECK( x == std::vector<R4>{0.5f,1.5f} );
+
+    node_value y(std::vector<R8>{1e300});
+    CHECK_THROWS_AS( convert_data_type(y,data_type_id::R4) , const cgns_exception& );
+  }
+
+  SUBCASE("unsupported") {
+    node_value x(std::vector<I4>{1,2});
+    CHECK_THROWS_AS( convert_data_type(x,data_type_id::R8) , const cgns_exception& );
+    node_value mt = MT();
+    CHECK_THROWS_AS( convert_data_type(mt,data_type_id::I4) , const cgns_exception& );
+  }
+
+  SUBCASE("big array, multithreaded") {
+    I8 n = (1<<20) + 3;
+    node_value x(std::vector<I4>(n,7));
+    conversion_options opts;
+    opts.n_threads = 4;
+    convert_data_type(x,data_type_id::I8,opts);
+    CHECK( x == std::vector<I8>(n,7) );
+  }
+
+  SUBCASE("whole tree") {
+    // [Sphinx Doc] data type conversion example {
+    tree t = {"Zone", "Zone_t", node_value({{3,2,0}}), {
+      tree{"NGon", "Elements_t", node_value({22,0}), {
+        tree{"ElementConnectivity", "DataArray_t", node_value({0,1,2,3})},
+        tree{"ElementStartOffset", "DataArray_t", node_value({0,4})} } } }
+    };
+    int n_converted = convert_all(t,data_type_id::I4,data_type_id::I8,{"DataArray_t"});
+    // [Sphinx Doc] data type conversion example }
+    CHECK( n_converted == 2 );
+    CHECK( value(t).type_id() == data_type_id::I4 );
+    CHECK( value(child(child(t,0),0)) == std::vector<I8>{0,1,2,3} );
+    CHECK( value(child(child(t,0),1)) == std::vector<I8>{0,4} );
+
+    CHECK( convert_all(t,data_type_id::I4,data_type_id::I8) == 2 ); // the Zone_t and Elements_t nodes
+  }
+}
+#endif // C++>17
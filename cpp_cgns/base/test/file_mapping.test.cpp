@@ -0,0 +1,68 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/file_mapping.hpp"
+#include <cstdio>
+#include <fstream>
+
+using namespace cgns;
+
+namespace {
+  auto
+  write_test_file(const std::string& file_name) -> void {
+    std::vector<R8> coords = {0.,1.,2.,3.,4.,5.};
+    std::vector<I4> connec = {10,11,12,13};
+    std::ofstream f(file_name,std::ios::binary);
+    f.write((const char*)coords.data(),coords.size()*sizeof(R8));
+    f.write((const char*)connec.data(),connec.size()*sizeof(I4));
+  }
+}
+
+TEST_CASE("file mapping") {
+  std::string file_name = "file_mapping_test.bin";
+  write_test_file(file_name);
+
+  SUBCASE("read only") {
+    // [Sphinx Doc] mapped node_value example {
+    auto mapping = map_file(file_name);
+    node_value coords = make_mapped_node_value(mapping,data_type_id::R8,0,{3,2});
+    node_value connec = make_mapped_node_value(mapping,data_type_id::I4,6*sizeof(R8),{4});
+    // [Sphinx Doc] mapped node_value example }
+    CHECK( mapping->size() == 6*8 + 4*4 );
+
+    CHECK( coords.type_id() == data_type_id::R8 );
+    CHECK( coords.rank() == 2 );
+    CHECK( coords(2,1) == 5. );
+    CHECK( connec == std::vector<I4>{10,11,12,13} );
+
+    mapping.reset(); // the mapping is still owned by the node values
+    CHECK( connec == std::vector<I4>{10,11,12,13} );
+  }
+
+  SUBCASE("copy on write") {
+    {
+      node_value connec = make_mapped_node_value(map_file(file_name,mapping_mode::copy_on_write),data_type_id::I4,48,{4});
+      data_as<I4>(connec)[0] = -1;
+      CHECK( connec == std::vector<I4>{-1,11,12,13} );
+    }
+    node_value connec = make_mapped_node_value(map_file(file_name),data_type_id::I4,48,{4});
+    CHECK( connec == std::vector<I4>{10,11,12,13} ); // the file is unchanged
+  }
+
+  SUBCASE("region") {
+    auto mapping = map_file(file_name,mapping_mode::read_only,48,16);
+    CHECK( mapping->size() == 16 );
+    node_value connec = make_mapped_node_value(mapping,data_type_id::I4,4,{3});
+    CHECK( connec == std::vector<I4>{11,12,13} );
+  }
+
+  SUBCASE("errors") {
+    CHECK_THROWS_AS( map_file("no_such_file.bin") , const cgns_exception& );
+    CHECK_THROWS_AS( map_file(file_name,mapping_mode::read_only,0,1000) , const cgns_exception& );
+    auto mapping = map_file(file_name);
+    CHECK_THROWS_AS( make_mapped_node_value(mapping,data_type_id::R8,48,{4}) , const cgns_exception& ); // too big
+    CHECK_THROWS_AS( make_mapped_node_value(mapping,data_type_id::I4,2,{1}) , const cgns_exception& ); // misaligned
+  }
+
+  std::remove(file_name.c_str());
+}
+#endif // C++>17
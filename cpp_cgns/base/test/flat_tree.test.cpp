@@ -0,0 +1,60 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/flat_tree.hpp"
+
+using namespace cgns;
+
+TEST_CASE("flat_tree") {
+  tree t = {
+    "A", "A_t", MT(), {
+      tree{"B0", "B_t", node_value({0,1,2}), {
+          tree{"D", "A_t", node_value({3.,4.}), {}} } },
+      tree{"B1", "B_t", MT(), {
+          tree{"D", "D_t", MT(), {}} } },
+      tree{"C", "C_t", node_value("hello")} }
+  };
+  tree t_ref = clone(t);
+
+  // [Sphinx Doc] flat_tree {
+  flat_tree ft = to_flat_tree(std::move(t));
+
+  CHECK( ft.size() == 6 );
+  CHECK( ft.names()         == std::vector<node_name>{"A","B0","D","B1","D","C"} );
+  CHECK( ft.parents()       == std::vector<flat_tree::index_type>{-1, 0, 1, 0, 3, 0} );
+  CHECK( ft.subtree_sizes() == std::vector<flat_tree::index_type>{ 6, 2, 1, 2, 1, 1} );
+  CHECK( ft.number_of_children(0) == 3 );
+  CHECK( ft.value(1) == std::vector<I4>{0,1,2} );
+
+  CHECK( find_indices_by_label(ft,"B_t") == std::vector<flat_tree::index_type>{1,3} );
+  CHECK( find_indices_by_name (ft,"D"  ) == std::vector<flat_tree::index_type>{2,4} );
+
+  tree t2 = to_tree(std::move(ft));
+  CHECK( t2 == t_ref );
+  // [Sphinx Doc] flat_tree }
+}
+
+TEST_CASE("flat_tree -- copy and view") {
+  tree t = {
+    "A", "A_t", MT(), {
+      tree{"B0", "B_t", node_value({0,1,2})},
+      tree{"C", "C_t", node_value("hello")} }
+  };
+  tree t_ref = clone(t);
+
+  flat_tree ft_copy = to_flat_tree(t);
+  flat_tree ft_view = view_as_flat_tree(t);
+  CHECK( ft_copy == ft_view );
+  CHECK( same_tree_structure(ft_copy,ft_view) );
+
+  // the view refers to the values of `t`
+  data_as<I4>(mutable_value(child(t,0)))[0] = 42;
+  CHECK( ft_view.value(1) == std::vector<I4>{42,1,2} );
+  CHECK( ft_copy.value(1) == std::vector<I4>{ 0,1,2} );
+  CHECK( ft_copy != ft_view );
+  CHECK( same_tree_structure(ft_copy,ft_view) );
+
+  // the tree is left untouched
+  data_as<I4>(mutable_value(child(t_ref,0)))[0] = 42;
+  CHECK( t == t_ref );
+}
+#endif // C++>17
@@ -0,0 +1,44 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/node_label.hpp"
+
+using namespace cgns;
+
+TEST_CASE("node_label") {
+  // [Sphinx Doc] node_label {
+  node_label l0 = "Zone_t";
+  node_label l1 = cgns_label::Zone_t;
+  node_label l2 = std::string("Zone_t");
+
+  CHECK( l0.is_sids_label() );
+  CHECK( l0 == l1 ); // comparison of integer ids
+  CHECK( l0 == l2 );
+  CHECK( l0 == cgns_label::Zone_t );
+  CHECK( l0 == "Zone_t" ); // comparison with a string
+  CHECK( l0 != "Base_t" );
+  CHECK( to_string(l0) == "Zone_t" );
+
+  node_label user_label = "MyLabel_t"; // not a SIDS label: registered on first use
+  CHECK( !user_label.is_sids_label() );
+  CHECK( user_label == node_label("MyLabel_t") );
+  CHECK( user_label.str() == "MyLabel_t" );
+  CHECK( user_label != l0 );
+  // [Sphinx Doc] node_label }
+}
+
+TEST_CASE("node_label - find") {
+  CHECK( node_label::find("Zone_t") == node_label(cgns_label::Zone_t) );
+  CHECK( !node_label::find("NeverUsedLabel_t") ); // not registered by the search
+  CHECK( !node_label::find("NeverUsedLabel_t") );
+
+  node_label l = "UsedLabel_t";
+  CHECK( node_label::find("UsedLabel_t") == l );
+  CHECK( find_labels({"Zone_t","NeverUsedLabel_t","UsedLabel_t"}) == std::vector<node_label>{cgns_label::Zone_t,l} );
+}
+
+TEST_CASE("node_label - default") {
+  node_label l;
+  CHECK( l == "" );
+  CHECK( l.str().size() == 0 );
+}
+#endif // C++>17
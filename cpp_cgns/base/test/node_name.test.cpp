@@ -0,0 +1,40 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/node_name.hpp"
+#include "cpp_cgns/base/exception.hpp"
+
+using namespace cgns;
+
+TEST_CASE("node_name") {
+  node_name n0 = "ZoneBC";
+  node_name n1 = std::string("ZoneBC");
+  node_name n2 = "ZoneGridConnectivity";
+
+  SUBCASE("access") {
+    CHECK( n0.size() == 6 );
+    CHECK( n0.str() == "ZoneBC" );
+    CHECK( to_string(n0) == "ZoneBC" );
+    CHECK( node_name().empty() );
+  }
+
+  SUBCASE("comparisons") {
+    CHECK( n0 == n1 );
+    CHECK( n0.hash() == n1.hash() );
+    CHECK( n0 != n2 );
+    CHECK( n0 == "ZoneBC" );
+    CHECK( n0 == std::string("ZoneBC") );
+    CHECK( n0 != "ZoneBC_" );
+  }
+
+  SUBCASE("concatenation") {
+    CHECK( "Zone/" + n0 == std::string("Zone/ZoneBC") );
+    CHECK( n0 + "/BC" == std::string("ZoneBC/BC") );
+  }
+
+  SUBCASE("CGNS names are limited to 32 characters") {
+    std::string s32(32,'a');
+    CHECK( node_name(s32).size() == 32 );
+    CHECK_THROWS_AS( node_name(s32+"a") , const cgns_exception& );
+  }
+}
+#endif // C++>17
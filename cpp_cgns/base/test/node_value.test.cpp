@@ -343,4 +343,25 @@ TEST_CASE("node_value assignments") {
     CHECK( x(1,0) == 30 ); CHECK( x(1,1) == 40 ); CHECK( x(1,2) == 50 );
   }
 }
+
+TEST_CASE("node_value data type id") {
+  // [Sphinx Doc] node_value type_id {
+  node_value x = {1.5,0.3};
+  CHECK( x.type_id() == data_type_id::R8 );
+  CHECK( x.type_id() == type_id_of<R8> );
+  CHECK( to_string(x.type_id()) == x.data_type() );
+  CHECK( n_byte(x.type_id()) == 8 );
+
+  CHECK( MT().type_id() == data_type_id::MT );
+  CHECK( node_value("abc").type_id() == data_type_id::C1 );
+  // [Sphinx Doc] node_value type_id }
+
+  SUBCASE("string conversions") {
+    CHECK( to_data_type_id("I4") == data_type_id::I4 );
+    CHECK( to_data_type_id("MT") == data_type_id::MT );
+    CHECK_THROWS_AS( to_data_type_id("I2") , const cgns_exception& );
+    CHECK( n_byte("I8") == 8 );
+    CHECK_THROWS_AS( n_byte("MT") , const cgns_exception& );
+  }
+}
 #endif // C++>17
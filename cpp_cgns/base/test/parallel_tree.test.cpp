@@ -0,0 +1,58 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/parallel_tree.hpp"
+#include "cpp_cgns/tree_manip.hpp"
+
+using namespace cgns;
+
+namespace {
+  auto
+  create_tree(int n_zone, I8 big_size) -> tree {
+    tree t = {"Base", "CGNSBase_t", MT()};
+    for (int i=0; i<n_zone; ++i) {
+      tree& z = emplace_child(t,tree{"Zone"+std::to_string(i), "Zone_t", node_value({i,i+1})});
+      for (int j=0; j<i%5; ++j) {
+        emplace_child(z,tree{"BC"+std::to_string(j), "BC_t", MT()});
+      }
+    }
+    emplace_child(child(t,0),tree{"Big", "DataArray_t", node_value(std::vector<R8>(big_size,1.))});
+    return t;
+  }
+}
+
+TEST_CASE("parallel tree algorithms") {
+  int n_threads = 4;
+  I8 big_size = (1<<20) + 10; // big enough to be compared by chunks
+  tree x = create_tree(50,big_size);
+  tree y = create_tree(50,big_size);
+
+  SUBCASE("for_each_node") {
+    std::atomic<int> n_node = 0;
+    parallel_for_each_node(x,[&n_node](const tree&){ ++n_node; },n_threads);
+    CHECK( n_node == 1 + 50 + (0+1+2+3+4)*10 + 1 );
+  }
+
+  SUBCASE("equal") {
+    CHECK( parallel_equal(x,y,n_threads) );
+    CHECK( parallel_same_tree_structure(x,y,n_threads) );
+  }
+
+  SUBCASE("different structure") {
+    emplace_child(child(y,33),tree{"Extra", "BC_t", MT()});
+    CHECK_FALSE( parallel_same_tree_structure(x,y,n_threads) );
+    CHECK_FALSE( parallel_equal(x,y,n_threads) );
+  }
+
+  SUBCASE("different values") {
+    data_as<I4>(mutable_value(child(y,42)))[1] = -1;
+    CHECK( parallel_same_tree_structure(x,y,n_threads) );
+    CHECK_FALSE( parallel_equal(x,y,n_threads) );
+  }
+
+  SUBCASE("different big values") {
+    data_as<R8>(mutable_value(get_child_by_name(child(y,0),"Big")))[big_size-1] = 2.;
+    CHECK_FALSE( parallel_equal(value(get_child_by_name(child(x,0),"Big")),value(get_child_by_name(child(y,0),"Big")),n_threads) );
+    CHECK_FALSE( parallel_equal(x,y,n_threads) );
+  }
+}
+#endif // C++>17
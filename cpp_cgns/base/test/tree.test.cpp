@@ -16,8 +16,8 @@ TEST_CASE("Hand-written tree construction - base") {
     }
   };
 
-  CHECK( name(t) == "Base" ); // name(t) returns a `std::string&`
-  CHECK( label(t) == "CGNSBase_t" ); // label(t) returns a `std::string&`
+  CHECK( name(t) == "Base" ); // name(t) returns a `cgns::node_name&`
+  CHECK( label(t) == "CGNSBase_t" ); // label(t) returns a `cgns::node_label&` (an interned string)
 
   // `value(t)` returns a `cgns::node_value`, which is a multi-dimensional array
   CHECK( value(t).data_type() == "I4" );
@@ -137,4 +137,53 @@ TEST_CASE("tree equality") {
   CHECK( !same_tree_structure(t0,t5) );
   // [Sphinx Doc] tree equality }
 }
+TEST_CASE("tree clone") {
+  tree t = {
+    "A", "A_t", node_value({0,1,2}), {
+      tree{"B", "B_t", node_value({3.,4.}), {
+          tree{"C", "C_t", MT(), {}} } } }
+  };
+
+  SUBCASE("deep copy") {
+    tree t2 = clone(t);
+    CHECK( t2 == t );
+    data_as<I4>(mutable_value(t2))[0] = 42;
+    CHECK( t2 != t );
+  }
+
+  SUBCASE("copy-on-write") {
+    // [Sphinx Doc] tree clone {
+    tree t2 = cow_clone(t); // the values are not copied...
+    CHECK( is_value_shared(t) );
+    CHECK( is_value_shared(t2) );
+    CHECK( data_as<I4>(value(t2)) == data_as<I4>(value(t)) );
+    CHECK( value(t2) == std::vector<I4>{0,1,2} ); // reading does not copy
+    CHECK( is_value_shared(t2) );
+
+    data_as<I4>(mutable_value(t2))[0] = 42; // ...until a value is accessed for modification
+    CHECK( !is_value_shared(t2) );
+    CHECK( value(t) == std::vector<I4>{0,1,2} );
+    CHECK( value(t2) == std::vector<I4>{42,1,2} );
+
+    CHECK( is_value_shared(child(t2,0)) ); // the other values are still shared
+    // [Sphinx Doc] tree clone }
+
+    // the last owner takes the value back
+    mutable_value(t);
+    CHECK( !is_value_shared(t) );
+    CHECK( value(t) == std::vector<I4>{0,1,2} );
+  }
+
+  SUBCASE("copy-on-write - replacing a value") {
+    tree t2 = cow_clone(t);
+    set_value(t2,node_value({7,8})); // the shared value is not copied before being replaced
+    CHECK( !is_value_shared(t2) );
+    CHECK( value(std::as_const(t2)) == std::vector<I4>{7,8} );
+    CHECK( value(std::as_const(t)) == std::vector<I4>{0,1,2} );
+
+    data_as<R8>(mutable_value(child(t2,0)))[0] = 42.;
+    CHECK( !is_value_shared(child(t2,0)) );
+    CHECK( is_value_shared(child(t,0)) );
+  }
+}
 #endif // C++>17
@@ -0,0 +1,60 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/tree_arena.hpp"
+
+using namespace cgns;
+
+TEST_CASE("tree_arena") {
+  tree_arena arena;
+
+  SUBCASE("explicit allocation") {
+    tree t = arena.new_tree("Base","CGNSBase_t",node_value({3,3}));
+    CHECK( children(t).get_allocator().resource() == arena.resource() );
+
+    SUBCASE("children are moved into the arena") {
+      tree z = {"Z0","Zone_t",MT(),{tree{"ZoneType","ZoneType_t",node_value("Unstructured")}}};
+      CHECK( children(z).get_allocator().resource() != arena.resource() );
+
+      tree& z_in_arena = emplace_child(t,std::move(z));
+      CHECK( children(z_in_arena).get_allocator().resource() == arena.resource() );
+      CHECK( children(child(z_in_arena,0)).get_allocator().resource() == arena.resource() );
+      CHECK( name(child(z_in_arena,0)) == "ZoneType" );
+    }
+  }
+
+  SUBCASE("adopt") {
+    tree t = {"Base","CGNSBase_t",MT(),{tree{"Z0","Zone_t",MT()}}};
+    tree t_in_arena = arena.adopt(std::move(t));
+    CHECK( children(t_in_arena).get_allocator().resource() == arena.resource() );
+    CHECK( children(child(t_in_arena,0)).get_allocator().resource() == arena.resource() );
+    CHECK( name(child(t_in_arena,0)) == "Z0" );
+  }
+
+  SUBCASE("explicit allocation of children") {
+    // [Sphinx Doc] tree arena {
+    tree_arena my_arena;
+    {
+      auto a = my_arena.allocator(); // the arena is used by passing its allocator explicitly
+      tree t = {
+        std::allocator_arg, a, "Base", "CGNSBase_t", node_value({3,3}), {
+          tree{std::allocator_arg,a,"Z0","Zone_t",MT()},
+          tree{std::allocator_arg,a,"Z1","Zone_t",MT()}
+        }
+      };
+      CHECK( children(t).get_allocator().resource() == my_arena.resource() );
+      CHECK( children(child(t,1)).get_allocator().resource() == my_arena.resource() );
+    } // `t` is destroyed: no memory is given back to the system here...
+    my_arena.release(); // ... but here, all at once
+    // [Sphinx Doc] tree arena }
+  }
+
+  SUBCASE("the default memory resource is not modified") {
+    tree t = arena.new_tree("Base","CGNSBase_t",MT(),{tree{"Z0","Zone_t",MT()}});
+    CHECK( children(child(t,0)).get_allocator().resource() == arena.resource() ); // moved into the arena
+
+    tree other = {"Base","CGNSBase_t",MT()};
+    CHECK( children(other).get_allocator().resource() == std::pmr::get_default_resource() );
+    CHECK( std::pmr::get_default_resource() != arena.resource() );
+  }
+}
+#endif // C++>17
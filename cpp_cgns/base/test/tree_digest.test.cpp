@@ -0,0 +1,61 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/tree_digest.hpp"
+
+using namespace cgns;
+
+TEST_CASE("tree digest") {
+  tree t0 = {
+    "A", "A_t", MT(), {
+      tree{"B0", "B_t", node_value({0,1,2}), {
+          tree{"D", "A_t", node_value({3.,4.}), {}} } },
+      tree{"B1", "B_t", MT(), {
+          tree{"D", "D_t", MT(), {}} } } }
+  };
+  tree t1 = clone(t0);
+
+  CHECK( subtree_digest(t0) == subtree_digest(t1) );
+
+  SUBCASE("snapshot") {
+    tree_digest d0(t0);
+    CHECK( d0.size() == 5 );
+    CHECK( d0.root() == subtree_digest(t0) );
+    CHECK( d0.subtree(1) == subtree_digest(child(t0,0)) );
+    CHECK( d0.subtree_size(1) == 2 );
+    CHECK( d0.node(2) == node_digest(child(child(t0,0),0)) );
+  }
+
+  SUBCASE("value change") {
+    tree_digest before(t0);
+    data_as<R8>(mutable_value(child(child(t0,0),0)))[1] = 5.;
+    tree_digest after(t0);
+
+    CHECK( before.root() != after.root() );
+    CHECK( before.subtree(1) != after.subtree(1) ); // B0 changed
+    CHECK( before.subtree(3) == after.subtree(3) ); // B1 did not
+    CHECK_FALSE( equal(t0,after,t1,tree_digest(t1)) );
+  }
+
+  SUBCASE("name, label, type, shape") {
+    digest_type d = node_digest(child(t0,0));
+    name(child(t1,0)) = "B2";
+    CHECK( node_digest(child(t1,0)) != d );
+
+    tree c0 = {"B0", "B_t", node_value({0,1,2})};
+    CHECK( node_digest(c0) == d );
+    tree c1 = {"B0", "C_t", node_value({0,1,2})};
+    CHECK( node_digest(c1) != d );
+    tree c2 = {"B0", "B_t", node_value(std::vector<I8>{0,1,2})};
+    CHECK( node_digest(c2) != d );
+    tree c3 = {"B0", "B_t", node_value({{0},{1},{2}})};
+    CHECK( node_digest(c3) != d );
+  }
+
+  SUBCASE("structure") {
+    // the same nodes, but organized differently
+    tree x = {"A", "A_t", MT(), {tree{"B", "B_t", MT(), {tree{"C", "C_t", MT()}}}}};
+    tree y = {"A", "A_t", MT(), {tree{"B", "B_t", MT()}, tree{"C", "C_t", MT()}}};
+    CHECK( subtree_digest(x) != subtree_digest(y) );
+  }
+}
+#endif // C++>17
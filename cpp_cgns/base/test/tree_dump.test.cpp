@@ -0,0 +1,70 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/base/tree_dump.hpp"
+#include <sstream>
+
+using namespace cgns;
+
+TEST_CASE("tree dump") {
+  tree t = {
+    "Base", "CGNSBase_t", node_value({3,3}), {
+      tree{"Z0", "Zone_t", MT(), {
+          tree{"ZoneBC", "ZoneBC_t", MT(), {
+              tree{"BC0", "BC_t", MT()} } } } },
+      tree{"Z1", "Zone_t", node_value(std::vector<R8>{1.,2.,3.,4.,5.,6.,7.,8.,9.,10.,11.,12.}) } }
+  };
+
+  SUBCASE("default") {
+    std::ostringstream ss;
+    dump(ss,t);
+    std::string expected_dump =
+      "Base, I4[3,3], CGNSBase_t\n"
+      "  Z0, MT, Zone_t\n"
+      "    ZoneBC, MT, ZoneBC_t\n"
+      "      BC0, MT, BC_t\n"
+      "  Z1, R8{12}, Zone_t\n";
+    CHECK( ss.str() == expected_dump );
+    CHECK( to_string(t) == expected_dump );
+  }
+
+  SUBCASE("options") {
+    // [Sphinx Doc] tree dump {
+    dump_options opts;
+    opts.max_depth = 1;
+    opts.array_summaries = true;
+
+    std::ostringstream ss;
+    dump(ss,t,opts);
+    CHECK( ss.str() ==
+      "Base, I4[3,3], CGNSBase_t\n"
+      "  Z0, MT, Zone_t\n"
+      "  Z1, R8{12} (min=1, max=12, mean=6.5), Zone_t\n"
+    );
+    // [Sphinx Doc] tree dump }
+  }
+
+  SUBCASE("node filter") {
+    dump_options opts;
+    opts.node_filter = [](const tree& n, int depth){ return depth>1 || name(n)=="Z0"; };
+
+    std::ostringstream ss;
+    dump(ss,t,opts);
+    CHECK( ss.str() ==
+      "Base, I4[3,3], CGNSBase_t\n"
+      "  Z0, MT, Zone_t\n"
+      "    ZoneBC, MT, ZoneBC_t\n"
+      "      BC0, MT, BC_t\n"
+    );
+  }
+
+  SUBCASE("fixed buffer") {
+    char buf[20];
+    fixed_buffer_streambuf sbuf(buf,20);
+    std::ostream os(&sbuf);
+    dump(os,t);
+    CHECK( sbuf.size() == 20 );
+    CHECK( sbuf.truncated() );
+    CHECK( std::string(buf,20) == "Base, I4[3,3], CGNSB" );
+  }
+}
+#endif // C++>17
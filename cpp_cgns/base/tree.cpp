@@ -3,6 +3,12 @@
 
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <unordered_map>
+#include <sstream>
+#include "cpp_cgns/base/tree_dump.hpp"
 #include "std_e/graph/algorithm/zip.hpp"
 #include "std_e/graph/algorithm/algo_adjacencies.hpp"
 
@@ -10,6 +16,277 @@
 namespace cgns {
 
 
+// children name index {
+struct children_name_index {
+  std::unordered_map<node_name,int> positions; // position of the first child of each name
+  size_t n_indexed; // number of children taken into account
+  std::uint64_t name_assignments; // value of `name_assignment_count` when the index was built
+  bool has_duplicate_names;
+  // indices replaced by a const search: other threads may still be reading them, so they are only deleted by a non-const operation
+  std::unique_ptr<children_name_index> replaced;
+  int n_replaced;
+};
+
+namespace {
+  // only used to build the index: contention is not an issue
+  std::mutex name_index_build_mutex;
+  std::atomic<std::int64_t> n_name_index_builds = 0;
+
+  // if a node is renamed again and again while its parent is searched through const functions,
+  // stop keeping replaced indices alive (then search linearly until a non-const operation deletes them)
+  constexpr int max_replaced_name_indices = 4;
+
+  auto
+  build_name_index(const tree_children& cs) -> children_name_index* {
+    // the count is read first: an assignment happening during the build makes the index stale
+    auto idx = new children_name_index{{},cs.size(),name_assignment_count.load(std::memory_order_relaxed),false,nullptr,0};
+    idx->positions.reserve(cs.size());
+    for (int i=0; i<(int)cs.size(); ++i) {
+      bool inserted = idx->positions.emplace(name(cs[i]),i).second; // if several children have the same name, keep the first one
+      idx->has_duplicate_names = idx->has_duplicate_names || !inserted;
+    }
+    ++n_name_index_builds;
+    return idx;
+  }
+
+  auto
+  is_up_to_date(const children_name_index* idx, size_t n_children) -> bool {
+    return idx->n_indexed==n_children && idx->name_assignments==name_assignment_count.load(std::memory_order_relaxed);
+  }
+}
+
+tree_children::
+tree_children(tree_children&& x)
+  : base(std::move(x))
+  , name_index_(x.name_index_.exchange(nullptr))
+{}
+tree_children::
+tree_children(tree_children&& x, const allocator_type& a)
+  : base(std::move(x),a) // children keep their positions, so the index stays valid
+  , name_index_(x.name_index_.exchange(nullptr))
+{}
+auto tree_children::
+operator=(tree_children&& x) -> tree_children& {
+  {
+    untracked_name_assignments untracked; // with different allocators, the children are moved one by one
+    base::operator=(std::move(x));
+  }
+  delete name_index_.exchange(x.name_index_.exchange(nullptr));
+  return *this;
+}
+tree_children::
+~tree_children() {
+  delete name_index_.load();
+}
+
+auto tree_children::
+number_of_name_index_builds() -> std::int64_t {
+  return n_name_index_builds.load();
+}
+
+auto tree_children::
+name_index() const -> const children_name_index* {
+  if (size()<name_index_min_size) return nullptr;
+  children_name_index* idx = name_index_.load(std::memory_order_acquire);
+  if (idx!=nullptr && is_up_to_date(idx,size())) return idx;
+
+  std::lock_guard lock(name_index_build_mutex);
+  idx = name_index_.load(std::memory_order_relaxed);
+  if (idx!=nullptr && is_up_to_date(idx,size())) return idx; // rebuilt by another thread in the meantime
+  if (idx!=nullptr && idx->n_replaced==max_replaced_name_indices) return nullptr;
+
+  children_name_index* new_idx = build_name_index(*this);
+  if (idx!=nullptr) {
+    new_idx->n_replaced = idx->n_replaced+1;
+    new_idx->replaced.reset(idx);
+  }
+  name_index_.store(new_idx,std::memory_order_release);
+  return new_idx;
+}
+auto tree_children::
+up_to_date_name_index() -> children_name_index* {
+  // non-const: no other thread can be reading the index, so the stale and replaced ones can be deleted
+  children_name_index* idx = name_index_.load(std::memory_order_relaxed);
+  if (idx==nullptr) return nullptr;
+  if (!is_up_to_date(idx,size())) {
+    invalidate_name_index();
+    return nullptr;
+  }
+  idx->replaced.reset();
+  idx->n_replaced = 0;
+  return idx;
+}
+
+auto tree_children::
+find_by_name(const node_name& n) const -> const_iterator {
+  const children_name_index* idx = name_index();
+  if (idx==nullptr) {
+    return std::find_if(begin(),end(),[&n](const tree& c){ return name(c)==n; });
+  }
+  auto it = idx->positions.find(n);
+  if (it==idx->positions.end()) return end();
+  return begin()+it->second;
+}
+auto tree_children::
+find_by_name(const node_name& n) -> iterator {
+  up_to_date_name_index(); // deletes a stale index before it is rebuilt
+  auto pos = std::as_const(*this).find_by_name(n);
+  return begin() + (pos-cbegin());
+}
+
+auto tree_children::
+add_back_to_name_index() -> void {
+  children_name_index* idx = name_index_.load(std::memory_order_relaxed);
+  if (idx==nullptr) return;
+  if (idx->n_indexed+1 != size() || idx->name_assignments != name_assignment_count.load(std::memory_order_relaxed)) {
+    invalidate_name_index();
+    return;
+  }
+  bool inserted = idx->positions.emplace(name(back()),size()-1).second;
+  idx->has_duplicate_names = idx->has_duplicate_names || !inserted;
+  ++idx->n_indexed;
+}
+auto tree_children::
+invalidate_name_index() -> void {
+  delete name_index_.exchange(nullptr);
+}
+
+auto tree_children::
+push_back(tree&& t) -> void {
+  emplace_back(std::move(t));
+}
+auto tree_children::
+pop_back() -> void {
+  erase(end()-1);
+}
+auto tree_children::
+push_front(tree&& t) -> void {
+  emplace_front(std::move(t));
+}
+auto tree_children::
+pop_front() -> void {
+  base::pop_front();
+  invalidate_name_index(); // all the positions are shifted
+}
+auto tree_children::
+insert(const_iterator pos, tree&& t) -> iterator {
+  return emplace(pos,std::move(t));
+}
+auto tree_children::
+erase(const_iterator pos) -> iterator {
+  children_name_index* idx = up_to_date_name_index();
+  int i = pos-cbegin();
+  node_name erased_name = name(*pos);
+  bool erases_first_of_name = false;
+  if (idx!=nullptr) {
+    auto it = idx->positions.find(erased_name);
+    erases_first_of_name = (it->second==i);
+    if (erases_first_of_name) idx->positions.erase(it);
+  }
+
+  iterator next;
+  {
+    untracked_name_assignments untracked; // the children on one side of `pos` are moved by assignment
+    next = base::erase(pos);
+  }
+
+  if (idx!=nullptr) {
+    for (auto& [n,j] : idx->positions) {
+      if (j>i) --j;
+    }
+    --idx->n_indexed;
+    // if another child has the same name, it is after `pos`, and it is now the first one of that name
+    if (erases_first_of_name && idx->has_duplicate_names) {
+      auto same_name = std::find_if(begin()+i,end(),[&erased_name](const tree& c){ return name(c)==erased_name; });
+      if (same_name!=end()) idx->positions.emplace(erased_name,same_name-begin());
+    }
+  }
+  return next;
+}
+auto tree_children::
+erase(const_iterator first, const_iterator last) -> iterator {
+  if (last-first==1) return erase(first);
+  iterator next;
+  {
+    untracked_name_assignments untracked;
+    next = base::erase(first,last);
+  }
+  invalidate_name_index();
+  return next;
+}
+auto tree_children::
+clear() -> void {
+  base::clear();
+  invalidate_name_index();
+}
+auto tree_children::
+resize(size_t n) -> void {
+  base::resize(n);
+  invalidate_name_index();
+}
+auto tree_children::
+swap(tree_children& x) -> void {
+  base::swap(x);
+  children_name_index* idx = name_index_.load(std::memory_order_relaxed);
+  name_index_.store(x.name_index_.exchange(idx));
+}
+// children name index }
+
+
+// clone {
+auto
+clone(const tree& t) -> tree {
+  tree res(name(t),label(t),clone(value(t)));
+  for (const tree& c : children(t)) {
+    emplace_child(res,clone(c));
+  }
+  return res;
+}
+
+namespace {
+  auto
+  view_of(node_value& x) -> node_value {
+    return make_non_owning_node_value(x.type_id(),x.data(),x.extent());
+  }
+}
+
+auto
+cow_clone(tree& t) -> tree {
+  tree res(t.name_,t.label_,MT());
+  if (t.value_.type_id()!=data_type_id::MT) {
+    if (!t.shared_value_) {
+      t.shared_value_ = std::make_shared<node_value>(std::move(t.value_));
+      t.value_ = view_of(*t.shared_value_);
+    }
+    res.value_ = view_of(*t.shared_value_);
+    res.shared_value_ = t.shared_value_;
+  }
+  for (tree& c : t.children_) {
+    emplace_child(res,cow_clone(c));
+  }
+  return res;
+}
+
+auto
+is_value_shared(const tree& t) -> bool {
+  return t.shared_value_!=nullptr;
+}
+
+auto tree::
+detach_shared_value() -> void {
+  if (shared_value_.use_count()==1) {
+    // the other owners are gone, but may have read the buffer from other threads (e.g. an async_writer snapshot):
+    // `use_count` is a relaxed load, so synchronize with their release of the buffer before writing into it
+    std::atomic_thread_fence(std::memory_order_acquire);
+    value_ = std::move(*shared_value_); // not shared anymore: take the buffer back
+  } else {
+    value_ = clone(*shared_value_);
+  }
+  shared_value_.reset();
+}
+// clone }
+
+
 // tree comparisons {
 auto
 same_tree_structure(const tree& x, const tree& y) -> bool {
@@ -43,18 +320,12 @@ operator!=(const tree& x, const tree& y) -> bool {
 
 
 // to_string {
-auto to_string_impl(const tree& t, const std::string& indent, int threshold) -> std::string {
-  // TODO replace by dfs
-  static const std::string unit_indent = "  ";
-  std::string s = indent + name(t) + ", " + to_string(value(t),threshold) + ", " + label(t) + "\n";
-  for (const tree& c : children(t)) {
-    s += to_string_impl(c,indent+unit_indent,threshold);
-  }
-  return s;
-}
-
 auto to_string(const tree& t, int threshold) -> std::string {
-  return to_string_impl(t,"",threshold);
+  std::ostringstream ss;
+  dump_options opts;
+  opts.threshold = threshold;
+  dump(ss,t,opts);
+  return ss.str();
 }
 // to_string }
 
@@ -2,7 +2,12 @@
 
 
 #include <deque>
+#include <memory_resource>
+#include <atomic>
+#include <memory>
 #include "cpp_cgns/base/node_value.hpp"
+#include "cpp_cgns/base/node_name.hpp"
+#include "cpp_cgns/base/node_label.hpp"
 #include "std_e/meta/pack.hpp"
 #include <functional> // for std::reference_wrapper
 
@@ -12,17 +17,17 @@ namespace cgns {
 
 class tree;
 class tree_children;
+struct children_name_index;
 
 
 // [Sphinx Doc] tree access {
-auto name    (      tree& t) ->       std::string  &;
-auto name    (const tree& t) -> const std::string  &;
+auto name    (      tree& t) ->       node_name    &;
+auto name    (const tree& t) -> const node_name    &;
 
-auto label   (      tree& t) ->       std::string  &;
-auto label   (const tree& t) -> const std::string  &;
+auto label   (      tree& t) ->       node_label   &;
+auto label   (const tree& t) -> const node_label   &;
 
-auto value   (      tree& t) ->       node_value   &;
-auto value   (const tree& t) -> const node_value   &;
+auto value   (const tree& t) -> const node_value   &; // read-only, even for a non-const tree (see `mutable_value`)
 
 auto children(      tree& t) ->       tree_children&;
 auto children(const tree& t) -> const tree_children&;
@@ -38,22 +43,44 @@ template<class Tree> auto child(Tree& t, int i) -> auto&;
 // [Sphinx Doc] tree children }
 
 
+// [Sphinx Doc] tree clone {
+/// deep copy
+auto clone(const tree& t) -> tree;
+/// copy-on-write copy: the node values of `t` and of the clone are shared until one of them is accessed for writing
+auto cow_clone(tree& t) -> tree;
+auto is_value_shared(const tree& t) -> bool;
+// [Sphinx Doc] tree clone }
+
+
 // ====================== impl ======================
-class tree_children : public std::deque<tree> {
+class tree_children : public std::deque<tree,std::pmr::polymorphic_allocator<tree>> {
   public:
-    using base = std::deque<tree>; // std::deque to guarantee reference stability when adding childrens
+    using base = std::deque<tree,std::pmr::polymorphic_allocator<tree>>; // std::deque to guarantee reference stability when adding childrens
+                                                                         // polymorphic_allocator to allow whole trees to live in an arena (see tree_arena.hpp)
+    using allocator_type = base::allocator_type;
+
+    // under this number of children, a linear search by name is used
+    static constexpr size_t name_index_min_size = 16;
 
   // ctors
     /// special
     tree_children() = default;
-    tree_children(tree_children&&) = default;
-    tree_children& operator=(tree_children&&) = default;
+    tree_children(tree_children&& x);
+    tree_children& operator=(tree_children&& x);
     tree_children(const tree_children&) = delete;
     tree_children& operator=(const tree_children&) = delete;
+    ~tree_children();
+
+    /// with allocator
+    explicit
+    tree_children(const allocator_type& a)
+      : base(a)
+    {}
+    tree_children(tree_children&& x, const allocator_type& a);
 
     /// from size
-    tree_children(int n)
-      : base(n)
+    tree_children(int n, const allocator_type& a = {})
+      : base(n,a)
     {}
 
     /// from range
@@ -63,6 +90,44 @@ class tree_children : public std::deque<tree> {
     template<class... Trees>
       requires (std_e::are_all_of<tree,Trees...>)
     tree_children(Trees&&... ts);
+
+  // search by name
+    // Once there are enough children, a name -> position index is lazily built (in a thread-safe manner)
+    // The index is kept up-to-date by the modifying member functions below
+    // Renamed or re-assigned children (`name(c) = ...`, `c = std::move(t)`) are detected through `name_assignment_count`:
+    // the index is then rebuilt by the next search
+    // Hence both a found and a missing name are answered in constant time
+    auto find_by_name(const node_name& n)       ->       iterator;
+    auto find_by_name(const node_name& n) const -> const_iterator;
+
+    /// number of name indices built since the start of the program (for diagnostics)
+    static auto number_of_name_index_builds() -> std::int64_t;
+
+  // modification
+    // same as the std::deque functions, but the name index is kept up-to-date
+    // (in constant time when adding at the back, in linear time otherwise)
+    template<class... Args> auto emplace_back(Args&&... args) -> tree&;
+    auto push_back(tree&& t) -> void;
+    auto pop_back() -> void;
+    template<class... Args> auto emplace_front(Args&&... args) -> tree&;
+    auto push_front(tree&& t) -> void;
+    auto pop_front() -> void;
+    template<class... Args> auto emplace(const_iterator pos, Args&&... args) -> iterator;
+    auto insert(const_iterator pos, tree&& t) -> iterator;
+    auto erase(const_iterator pos) -> iterator;
+    auto erase(const_iterator first, const_iterator last) -> iterator;
+    auto clear() -> void;
+    auto resize(size_t n) -> void;
+    auto swap(tree_children& x) -> void;
+
+    /// to call when the children have been modified through the std::deque base class, or moved around in an `untracked_name_assignments` scope
+    auto invalidate_name_index() -> void;
+  private:
+    auto name_index() const -> const children_name_index*;
+    auto up_to_date_name_index() -> children_name_index*;
+    auto add_back_to_name_index() -> void;
+
+    mutable std::atomic<children_name_index*> name_index_ = nullptr; // owning
 };
 
 
@@ -78,11 +143,23 @@ inline auto  last_root(const tree_children& tc) -> auto { return tc.end()  ; }
 
 class tree {
   private:
-    std::string name_;
-    std::string label_;
+    node_name name_;
+    node_label label_;
     node_value value_;
     tree_children children_;
+    // if not null, `value_` is a non-owning view of `*shared_value_`, which is shared with other trees (see `cow_clone`)
+    std::shared_ptr<node_value> shared_value_;
+
+    auto
+    detach_value() -> void {
+      if (shared_value_) [[unlikely]] detach_shared_value();
+    }
+    auto detach_shared_value() -> void;
   public:
+    // the allocator is only used for the children storage
+    // it is propagated to the children when they are emplaced (uses-allocator construction)
+    using allocator_type = tree_children::allocator_type;
+
   // ctors
     // special
     tree() = default;
@@ -92,49 +169,96 @@ class tree {
     tree(const tree&) = delete;
     tree& operator=(const tree&) = delete;
 
+    // special, with allocator
+    tree(std::allocator_arg_t, const allocator_type& a)
+      : children_(a)
+    {}
+    tree(std::allocator_arg_t, const allocator_type& a, tree&& t)
+      : name_(std::move(t.name_))
+      , label_(std::move(t.label_))
+      , value_(std::move(t.value_))
+      , children_(std::move(t.children_),a)
+      , shared_value_(std::move(t.shared_value_))
+    {}
+
     // with number of children
     template<std::integral I>
-    tree(std::string name, std::string label, node_value value, I number_of_children)
+    tree(node_name name, node_label label, node_value value, I number_of_children)
       : name_(std::move(name))
       , label_(std::move(label))
       , value_(std::move(value))
       , children_(number_of_children)
     {}
+    template<std::integral I>
+    tree(std::allocator_arg_t, const allocator_type& a, node_name name, node_label label, node_value value, I number_of_children)
+      : name_(std::move(name))
+      , label_(std::move(label))
+      , value_(std::move(value))
+      , children_(number_of_children,a)
+    {}
 
     // with no child
-    tree(std::string name, std::string label, node_value value)
+    tree(node_name name, node_label label, node_value value)
       : tree(std::move(name),std::move(label),std::move(value),0)
     {}
+    tree(std::allocator_arg_t, const allocator_type& a, node_name name, node_label label, node_value value)
+      : tree(std::allocator_arg,a,std::move(name),std::move(label),std::move(value),0)
+    {}
 
     // with range of children
     template<class Tree_range>
       requires (!std::integral<Tree_range> && std::is_rvalue_reference_v<Tree_range&&>)
-    tree(std::string name, std::string label, node_value value, Tree_range&& children)
+    tree(node_name name, node_label label, node_value value, Tree_range&& children)
       : tree(std::move(name),std::move(label),std::move(value),children.size())
     {
+      untracked_name_assignments untracked; // `children_` is not indexed yet
+      std::move(children.begin(),children.end(),begin(children_));
+    }
+    template<class Tree_range>
+      requires (!std::integral<Tree_range> && std::is_rvalue_reference_v<Tree_range&&>)
+    tree(std::allocator_arg_t, const allocator_type& a, node_name name, node_label label, node_value value, Tree_range&& children)
+      : tree(std::allocator_arg,a,std::move(name),std::move(label),std::move(value),children.size())
+    {
+      untracked_name_assignments untracked; // `children_` is not indexed yet
       std::move(children.begin(),children.end(),begin(children_));
     }
 
     // with range of children, specialized for init-list
-    tree(std::string name, std::string label, node_value value, std::initializer_list<tree> children)
+    tree(node_name name, node_label label, node_value value, std::initializer_list<tree> children)
       : tree(std::move(name),std::move(label),std::move(value),children.size())
     {
+      untracked_name_assignments untracked; // `children_` is not indexed yet
+      std::move((tree*)children.begin(),(tree*)children.end(),begin(children_));
+    }
+    /// children not allocated with `a` are moved into its memory resource
+    tree(std::allocator_arg_t, const allocator_type& a, node_name name, node_label label, node_value value, std::initializer_list<tree> children)
+      : tree(std::allocator_arg,a,std::move(name),std::move(label),std::move(value),children.size())
+    {
+      untracked_name_assignments untracked; // `children_` is not indexed yet
       std::move((tree*)children.begin(),(tree*)children.end(),begin(children_));
     }
 
   // access functions
     // NOTE: access functions are non-member because we want them to also work on std::reference_wrapper<Tree>
-    friend inline auto name    (      tree& t) ->       std::string  & { return t.name_;     }
-    friend inline auto name    (const tree& t) -> const std::string  & { return t.name_;     }
+    friend inline auto name    (      tree& t) ->       node_name    & { return t.name_;     }
+    friend inline auto name    (const tree& t) -> const node_name    & { return t.name_;     }
 
-    friend inline auto label   (      tree& t) ->       std::string  & { return t.label_;    }
-    friend inline auto label   (const tree& t) -> const std::string  & { return t.label_;    }
+    friend inline auto label   (      tree& t) ->       node_label   & { return t.label_;    }
+    friend inline auto label   (const tree& t) -> const node_label   & { return t.label_;    }
 
-    friend inline auto value   (      tree& t) ->       node_value   & { return t.value_;    }
     friend inline auto value   (const tree& t) -> const node_value   & { return t.value_;    }
 
+    // copy-on-write (see `cow_clone`): a value shared with other trees is copied before being given for modification
+    // Hence `value` only gives read access, and the value is modified through `mutable_value` or `set_value`
+    friend inline auto mutable_value(tree& t) -> node_value& { t.detach_value(); return t.value_; }
+    /// a shared value is not copied before being replaced
+    friend inline auto set_value(tree& t, node_value x) -> void { t.value_ = std::move(x); t.shared_value_.reset(); }
+
     friend inline auto children(      tree& t) ->       tree_children& { return t.children_; }
     friend inline auto children(const tree& t) -> const tree_children& { return t.children_; }
+
+    friend auto cow_clone(tree& t) -> tree;
+    friend auto is_value_shared(const tree& t) -> bool;
 };
 
 
@@ -174,6 +298,26 @@ tree_children(Trees&&... ts)
   ( this->emplace_back(std::move(ts)) , ... );
 }
 
+template<class... Args> auto tree_children::
+emplace_back(Args&&... args) -> tree& {
+  tree& c = base::emplace_back(std::forward<Args>(args)...);
+  add_back_to_name_index();
+  return c;
+}
+template<class... Args> auto tree_children::
+emplace_front(Args&&... args) -> tree& {
+  tree& c = base::emplace_front(std::forward<Args>(args)...);
+  invalidate_name_index(); // all the positions are shifted
+  return c;
+}
+template<class... Args> auto tree_children::
+emplace(const_iterator pos, Args&&... args) -> iterator {
+  untracked_name_assignments untracked; // the children after `pos` are moved by assignment
+  auto it = base::emplace(pos,std::forward<Args>(args)...);
+  invalidate_name_index();
+  return it;
+}
+
 
 inline auto
 emplace_child(tree& t, tree&& c) -> tree& {
@@ -187,6 +331,17 @@ emplace_children(tree& t, std::vector<tree>&& cs) -> void {
   }
 }
 
+/// `mutable_value(t)` for a non-const tree, `value(t)` for a const one
+/// (for the functions that take `Tree` as a template parameter so as to give a mutable or a const access)
+template<class Tree> auto
+value_of_same_constness(Tree& t) -> auto& {
+  if constexpr (std::is_const_v<Tree>) {
+    return value(t);
+  } else {
+    return mutable_value(t);
+  }
+}
+
 inline auto
 number_of_children(const tree& t) -> int {
   return children(t).size();
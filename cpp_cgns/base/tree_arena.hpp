@@ -0,0 +1,68 @@
+#pragma once
+
+
+#include <memory_resource>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// A tree_arena is a monotonic memory resource for cgns::tree nodes
+// Trees built within an arena have their children storage carved from a few big slabs:
+//   - there is no heap allocation per node
+//   - deallocations are no-ops, and the slabs are released all at once when the arena is released or destroyed
+// The arena is used by passing its allocator explicitly: `tree(std::allocator_arg,arena.allocator(),...)`,
+// the `new_[CGNS_label]` functions of sids/creation.hpp, or `arena.new_tree(...)`
+// Note: the node values are not stored in the arena (they keep their own ownership model)
+// Note: a monotonic resource is not thread-safe: an arena must not be used by several threads at the same time
+// WARNING: a tree allocated in an arena must not outlive it
+class tree_arena {
+  public:
+    static constexpr size_t default_initial_size = 1 << 20; // 1 MiB
+
+  // ctors
+    tree_arena(size_t initial_size = default_initial_size, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : res(initial_size,upstream)
+    {}
+
+    tree_arena(const tree_arena&) = delete;
+    tree_arena& operator=(const tree_arena&) = delete;
+
+  // access
+    auto
+    resource() -> std::pmr::memory_resource* {
+      return &res;
+    }
+    auto
+    allocator() -> tree::allocator_type {
+      return tree::allocator_type(&res);
+    }
+
+  // tree creation
+    auto
+    new_tree(node_name name, node_label label, node_value value) -> tree {
+      return tree(std::allocator_arg,allocator(),std::move(name),std::move(label),std::move(value));
+    }
+    auto
+    new_tree(node_name name, node_label label, node_value value, std::initializer_list<tree> children) -> tree {
+      return tree(std::allocator_arg,allocator(),std::move(name),std::move(label),std::move(value),children);
+    }
+    /// moves `t` into the arena (its sub-trees included)
+    auto
+    adopt(tree&& t) -> tree {
+      return tree(std::allocator_arg,allocator(),std::move(t));
+    }
+
+  // release
+    /// WARNING: all the trees allocated in the arena must have been destroyed before
+    auto
+    release() -> void {
+      res.release();
+    }
+  private:
+    std::pmr::monotonic_buffer_resource res;
+};
+
+
+} // cgns
@@ -0,0 +1,98 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/tree_digest.hpp"
+
+
+#include "cpp_cgns/base/hash.hpp"
+
+
+namespace cgns {
+
+
+// digests {
+namespace {
+
+auto
+string_digest(std::string_view s) -> digest_type {
+  return hash_bytes(s.data(),s.size());
+}
+
+auto
+combine_with_children(digest_type node_h, const std::vector<digest_type>& children_h) -> digest_type {
+  digest_type h = hash_combine(node_h,children_h.size());
+  for (digest_type c_h : children_h) {
+    h = hash_combine(h,c_h);
+  }
+  return h;
+}
+
+} // anonymous
+
+auto
+value_digest(const node_value& x) -> digest_type {
+  data_type_id data_type = x.type_id();
+  digest_type h = string_digest(to_string_view(data_type)); // not the enum value, to keep the digests stable
+  if (data_type==data_type_id::MT) return h;
+
+  for (int i=0; i<(int)x.rank(); ++i) {
+    I8 dim = x.extent(i);
+    h = hash_combine(h,hash_bytes(&dim,sizeof(I8)));
+  }
+  size_t n_bytes = x.visit([&x]<class T>(const std_e::polymorphic_array<T>&){ return x.size()*sizeof(T); });
+  return hash_combine(h,hash_bytes(x.data(),n_bytes));
+}
+
+auto
+node_digest(const tree& t) -> digest_type {
+  digest_type h = string_digest(name(t).str());
+  h = hash_combine(h,string_digest(label(t).str())); // not the label id: it depends on the interning order
+  return hash_combine(h,value_digest(value(t)));
+}
+
+auto
+subtree_digest(const tree& t) -> digest_type {
+  std::vector<digest_type> children_h;
+  children_h.reserve(number_of_children(t));
+  for (const tree& c : children(t)) {
+    children_h.push_back(subtree_digest(c));
+  }
+  return combine_with_children(node_digest(t),children_h);
+}
+// digests }
+
+
+// tree_digest {
+tree_digest::
+tree_digest(const tree& t) {
+  compute(t);
+}
+
+auto tree_digest::
+compute(const tree& t) -> digest_type {
+  index_type i = size();
+  node_digests_   .push_back(node_digest(t));
+  subtree_digests_.push_back(0);
+  subtree_sizes_  .push_back(1);
+
+  std::vector<digest_type> children_h;
+  children_h.reserve(number_of_children(t));
+  for (const tree& c : children(t)) {
+    children_h.push_back(compute(c));
+  }
+
+  digest_type h = combine_with_children(node_digests_[i],children_h);
+  subtree_digests_[i] = h;
+  subtree_sizes_[i] = size()-i;
+  return h;
+}
+// tree_digest }
+
+
+auto
+equal(const tree& x, const tree_digest& x_digest, const tree& y, const tree_digest& y_digest) -> bool {
+  if (x_digest.root() != y_digest.root()) return false;
+  return x==y; // same digests: still compare, since digests can collide
+}
+
+
+} // cgns
+#endif // C++>17
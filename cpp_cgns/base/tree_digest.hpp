@@ -0,0 +1,70 @@
+#pragma once
+
+
+#include <cstdint>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+using digest_type = std::uint64_t;
+
+// [Sphinx Doc] tree digest {
+/// digest of a node value: data type, shape and data
+auto value_digest(const node_value& x) -> digest_type;
+/// digest of the node itself: name, label, data type, shape and data
+auto node_digest(const tree& t) -> digest_type;
+/// Merkle digest of the sub-tree: node digest combined with the digests of the children, in order
+auto subtree_digest(const tree& t) -> digest_type;
+// [Sphinx Doc] tree digest }
+
+
+// A tree_digest is a snapshot of the Merkle digests of all the sub-trees of a tree, stored in preorder
+// If two sub-trees have different digests, they are different
+// If they have the same digest, they are equal with very high probability (64-bit non-cryptographic hash)
+//
+// The digests are not cached within the tree itself: since the node values can be modified in place
+// (e.g. through `data_as` or array views), a cache could not be reliably invalidated.
+// Instead, a tree_digest is computed explicitly, and kept as long as needed, e.g.
+//   - compute it after a solver iteration
+//   - compare it to the digest computed after the next iteration to find which sub-trees did change
+class tree_digest {
+  public:
+    using index_type = I4;
+
+  // ctors
+    tree_digest() = default;
+    explicit
+    tree_digest(const tree& t);
+
+  // access
+    auto
+    size() const -> index_type {
+      return subtree_digests_.size();
+    }
+    /// digest of the whole tree
+    auto
+    root() const -> digest_type {
+      return subtree_digests_[0];
+    }
+    /// `i` is the preorder index of the node
+    auto node   (index_type i) const -> digest_type { return node_digests_[i];    }
+    auto subtree(index_type i) const -> digest_type { return subtree_digests_[i]; }
+    auto subtree_size(index_type i) const -> index_type { return subtree_sizes_[i]; }
+  private:
+    auto compute(const tree& t) -> digest_type;
+
+    std::vector<digest_type> node_digests_;
+    std::vector<digest_type> subtree_digests_;
+    std::vector<index_type> subtree_sizes_;
+};
+
+
+/// equality, but first compare the digests
+/// useful if the digests have already been computed
+auto equal(const tree& x, const tree_digest& x_digest, const tree& y, const tree_digest& y_digest) -> bool;
+
+
+} // cgns
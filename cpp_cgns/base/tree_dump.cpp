@@ -0,0 +1,131 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/base/tree_dump.hpp"
+
+
+#include <cerrno>
+#include <ostream>
+#include <unistd.h>
+#include "std_e/multi_array/utils.hpp"
+#include "cpp_cgns/dispatch.hpp"
+
+
+namespace cgns {
+
+
+// dump {
+namespace {
+
+auto
+write_indent(std::ostream& os, int depth) -> void {
+  static constexpr std::string_view unit_indent = "  ";
+  for (int i=0; i<depth; ++i) {
+    os << unit_indent;
+  }
+}
+
+auto
+write_summary(std::ostream& os, const node_value& x) -> void {
+  data_type_id data_type = x.type_id();
+  if (data_type==data_type_id::MT || data_type==data_type_id::C1 || x.size()==0) return;
+  dispatch_on_data_type(
+    data_type,
+    [&os,&x]<class T>(T){
+      const T* data = data_as<T>(x);
+      I8 n = x.size();
+      T min = data[0];
+      T max = data[0];
+      double sum = 0.;
+      for (I8 i=0; i<n; ++i) {
+        min = std::min(min,data[i]);
+        max = std::max(max,data[i]);
+        sum += data[i];
+      }
+      os << " (min=" << min << ", max=" << max << ", mean=" << sum/n << ")";
+    }
+  );
+}
+
+auto
+write_node(std::ostream& os, const tree& t, int depth, const dump_options& opts) -> void {
+  const node_value& val = value(t);
+  write_indent(os,depth);
+  os << name(t) << ", " << to_string(val,opts.threshold);
+  if (opts.array_summaries && std_e::cartesian_product_size(val.extent()) > opts.threshold) {
+    write_summary(os,val);
+  }
+  os << ", " << label(t) << '\n';
+}
+
+struct dump_frame {
+  const tree* node;
+  int depth;
+};
+
+} // anonymous
+
+auto
+dump(std::ostream& os, const tree& t, const dump_options& opts) -> void {
+  // iterative preorder traversal
+  std::vector<dump_frame> stack = {{&t,0}};
+  while (!stack.empty()) {
+    auto [n,depth] = stack.back();
+    stack.pop_back();
+
+    if (opts.node_filter && depth>0 && !opts.node_filter(*n,depth)) continue;
+
+    write_node(os,*n,depth,opts);
+
+    if (depth < opts.max_depth) {
+      const auto& cs = children(*n);
+      for (auto it=cs.rbegin(); it!=cs.rend(); ++it) { // reversed, so that the first child is popped first
+        stack.push_back({&*it,depth+1});
+      }
+    }
+  }
+}
+// dump }
+
+
+// fd_streambuf {
+fd_streambuf::
+fd_streambuf(int fd)
+  : fd(fd)
+  , buf(buffer_size)
+{
+  setp(buf.data(),buf.data()+buf.size());
+}
+fd_streambuf::
+~fd_streambuf() {
+  flush_buffer();
+}
+
+auto fd_streambuf::
+flush_buffer() -> bool {
+  const char* p = pbase();
+  while (p < pptr()) {
+    ssize_t n = ::write(fd,p,pptr()-p);
+    if (n<0 && errno==EINTR) continue; // interrupted by a signal before anything was written: retry
+    if (n<=0) return false;
+    p += n;
+  }
+  setp(buf.data(),buf.data()+buf.size());
+  return true;
+}
+auto fd_streambuf::
+overflow(int_type c) -> int_type {
+  if (!flush_buffer()) return traits_type::eof();
+  if (!traits_type::eq_int_type(c,traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+auto fd_streambuf::
+sync() -> int {
+  return flush_buffer() ? 0 : -1;
+}
+// fd_streambuf }
+
+
+} // cgns
+#endif // C++>17
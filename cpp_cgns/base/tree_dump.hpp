@@ -0,0 +1,84 @@
+#pragma once
+
+
+#include <functional>
+#include <iosfwd>
+#include <limits>
+#include <streambuf>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+struct dump_options {
+  /// nodes deeper than `max_depth` are not printed (the root is at depth 0)
+  int max_depth = std::numeric_limits<int>::max();
+  /// if set, a node (other than the root) for which `node_filter(node,depth)` is false is not printed, nor its sub-tree
+  /// (e.g. `along_path` of cpp_cgns/compiled_path.hpp only prints the nodes along a path)
+  std::function<bool(const tree&, int)> node_filter = {};
+  /// arrays bigger than the threshold are only represented by their dimensions...
+  int threshold = default_threshold_to_print_whole_array;
+  /// ...and, if true, by their min, max and mean
+  bool array_summaries = false;
+};
+
+
+// [Sphinx Doc] tree dump {
+/// writes one line per node: "name, value, label", indented by depth
+/// the tree is traversed iteratively and directly written to `os`: there is no intermediate string
+auto dump(std::ostream& os, const tree& t, const dump_options& opts = {}) -> void;
+// [Sphinx Doc] tree dump }
+
+
+// streambufs {
+/// writes into a fixed-size memory buffer: what does not fit is discarded
+class fixed_buffer_streambuf : public std::streambuf {
+  public:
+    fixed_buffer_streambuf(char* buf, size_t n) {
+      setp(buf,buf+n);
+    }
+
+    auto
+    size() const -> size_t {
+      return pptr()-pbase();
+    }
+    auto
+    truncated() const -> bool {
+      return truncated_;
+    }
+  protected:
+    auto
+    overflow(int_type) -> int_type override {
+      truncated_ = true;
+      return traits_type::eof();
+    }
+  private:
+    bool truncated_ = false;
+};
+
+/// writes into a file descriptor (through a buffer)
+class fd_streambuf : public std::streambuf {
+  public:
+    static constexpr size_t buffer_size = 1 << 16;
+
+    explicit
+    fd_streambuf(int fd);
+    ~fd_streambuf();
+
+    fd_streambuf(const fd_streambuf&) = delete;
+    fd_streambuf& operator=(const fd_streambuf&) = delete;
+  protected:
+    auto overflow(int_type c) -> int_type override;
+    auto sync() -> int override;
+  private:
+    auto flush_buffer() -> bool;
+
+    int fd;
+    std::vector<char> buf;
+};
+// streambufs }
+
+
+} // cgns
@@ -0,0 +1,48 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/compiled_path.hpp"
+
+
+#include "std_e/utils/string.hpp"
+
+
+namespace cgns {
+
+
+path_component::
+path_component(std::string_view s)
+  : is_wildcard_(s==wildcard)
+  , can_be_name_(s.size() <= size_t(node_name::max_size))
+  , name_(can_be_name_ ? node_name(s) : node_name())
+  , label_(node_label::find(s))
+  , str_(label_ ? std::string() : std::string(s))
+{}
+
+
+compiled_path::
+compiled_path(const std::string& gen_path)
+  : gen_path_(gen_path)
+{
+  auto identifiers = std_e::split(gen_path,'/');
+  components_.reserve(identifiers.size());
+  for (const auto& id : identifiers) {
+    components_.emplace_back(id);
+  }
+}
+
+
+auto
+to_string(const compiled_path& p) -> std::string {
+  return p.str();
+}
+
+
+auto
+along_path(compiled_path p) -> std::function<bool(const tree&, int)> {
+  return [p=std::move(p)](const tree& t, int depth){
+    return depth==0 || depth>p.size() || p[depth-1].matches(t);
+  };
+}
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,96 @@
+#pragma once
+
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// One level of a generalized path (e.g. "ZoneBC" or "BC_t" in "ZoneBC/BC_t")
+// A node matches the component if its name or its label is equal to it
+// "*" is a wildcard that matches any node
+class path_component {
+  public:
+    static constexpr std::string_view wildcard = "*";
+
+  // ctors
+    explicit
+    path_component(std::string_view s);
+
+  // access
+    auto
+    is_wildcard() const -> bool {
+      return is_wildcard_;
+    }
+
+  // matching
+    auto
+    matches(const tree& t) const -> bool {
+      return matches_label(label(t)) || matches_name(name(t));
+    }
+    /// true if any node of name `n` matches, whatever its label
+    auto
+    matches_name(const node_name& n) const -> bool {
+      return is_wildcard_ || (can_be_name_ && n==name_);
+    }
+  private:
+    auto
+    matches_label(const node_label& l) const -> bool {
+      if (label_) return l==*label_;
+      // the string was not a label when the path was compiled, but may have been interned since
+      return !l.is_sids_label() && l.str()==str_;
+    }
+
+    bool is_wildcard_;
+    bool can_be_name_; // false if the string is longer than what a node_name can hold
+    node_name name_;
+    std::optional<node_label> label_; // not interned: nothing if the string was not a label yet
+    std::string str_;
+};
+
+
+// A compiled_path is a generalized path (components separated by '/') parsed once:
+// its components are converted to node_name and node_label ahead of time,
+// so that matching a node is only made of hash and id comparisons
+// It is meant to be built once and reused across searches, e.g.
+//   static const compiled_path bc_path("ZoneBC/BC_t");
+//   for (tree& z : zones) { auto bcs = get_nodes_by_matching(z,bc_path); ... }
+class compiled_path {
+  public:
+  // ctors
+    explicit
+    compiled_path(const std::string& gen_path);
+
+  // access
+    auto
+    size() const -> int {
+      return components_.size();
+    }
+    auto
+    operator[](int i) const -> const path_component& {
+      return components_[i];
+    }
+    auto
+    str() const -> const std::string& {
+      return gen_path_;
+    }
+  private:
+    std::string gen_path_;
+    std::vector<path_component> components_;
+};
+
+
+auto to_string(const compiled_path& p) -> std::string;
+
+
+/// node filter, e.g. for `dump_options::node_filter`:
+/// true for the nodes along `p` (the node at depth `d` matches component `d-1`), and for the nodes below the end of `p`
+auto along_path(compiled_path p) -> std::function<bool(const tree&, int)>;
+
+
+} // cgns
@@ -7,67 +7,139 @@
 namespace cgns {
 
 
+// dispatch on data_type_id {
 template<class F, class... Args> auto
-dispatch_I4_I8(const std::string& type, F f, Args&&... args) {
-  if (type=="I4") {
-    return f(I4{},FWD(args)...);
-  }
-  if (type=="I8") {
-    return f(I8{},FWD(args)...);
+dispatch_I4_I8(data_type_id type, F f, Args&&... args) {
+  switch (type) {
+    case data_type_id::I4: return f(I4{},FWD(args)...);
+    case data_type_id::I8: return f(I8{},FWD(args)...);
+    default: break;
   }
-  throw cgns_exception("dispatch_I4_I8 expects an integer data_type, but got "+type);
+  throw cgns_exception("dispatch_I4_I8 expects an integer data_type, but got "+to_string(type));
 }
 template<class F, class... Args> auto
-dispatch_I(F f, const std::string& type, Args&&... args) {
-  if (type=="I4") {
-    return f(I4{},FWD(args)...);
+dispatch_I(F f, data_type_id type, Args&&... args) {
+  switch (type) {
+    case data_type_id::I4: return f(I4{},FWD(args)...);
+    case data_type_id::I8: return f(I8{},FWD(args)...);
+    default: break;
   }
-  if (type=="I8") {
-    return f(I8{},FWD(args)...);
-  }
-  throw cgns_exception("dispatch_I expects a I4 or I8, but got "+type);
+  throw cgns_exception("dispatch_I expects a I4 or I8, but got "+to_string(type));
 }
 template<class F, class Node_value, class... Args> auto
 dispatch_integral_node_value(F f, Node_value& val, Args&&... args) {
-  std::string type = val.data_type();
-  if (type=="I4") {
-    return f(view_as_span<I4>(val),FWD(args)...);
+  data_type_id type = val.type_id();
+  switch (type) {
+    case data_type_id::I4: return f(view_as_span<I4>(val),FWD(args)...);
+    case data_type_id::I8: return f(view_as_span<I8>(val),FWD(args)...);
+    default: break;
   }
-  if (type=="I8") {
-    return f(view_as_span<I8>(val),FWD(args)...);
+  throw cgns_exception("dispatch_integral_node_value expects a node_value of I4 or I8, but got "+to_string(type));
+}
+
+template<class F, class... Args> auto
+dispatch_on_data_type(data_type_id type, F f, Args&&... args) {
+  switch (type) {
+    case data_type_id::C1: return f(C1{},FWD(args)...);
+    case data_type_id::I4: return f(I4{},FWD(args)...);
+    case data_type_id::I8: return f(I8{},FWD(args)...);
+    case data_type_id::R4: return f(R4{},FWD(args)...);
+    case data_type_id::R8: return f(R8{},FWD(args)...);
+    default: break;
   }
-  throw cgns_exception("dispatch_integral_node_value expects a node_value of I4 or I8, but got "+type);
+  throw cgns_exception("dispatch_on_data_type expects a C1, I4, I8, R4 or R8 data_type, but got "+to_string(type));
 }
+// dispatch on data_type_id }
 
 
+// dispatch on data type strings {
+// the strings are only parsed once, then the dispatch is done on data_type_id
+template<class F, class... Args> auto
+dispatch_I4_I8(const std::string& type, F f, Args&&... args) {
+  return dispatch_I4_I8(to_data_type_id(type),f,FWD(args)...);
+}
+template<class F, class... Args> auto
+dispatch_I(F f, const std::string& type, Args&&... args) {
+  return dispatch_I(f,to_data_type_id(type),FWD(args)...);
+}
 template<class F, class... Args> auto
 dispatch_on_data_type(const std::string& type, F f, Args&&... args) {
-  if (type=="C1") {
-    return f(C1{},FWD(args)...);
-  }
-  if (type=="I4") {
-    return f(I4{},FWD(args)...);
-  }
-  if (type=="I8") {
-    return f(I8{},FWD(args)...);
+  return dispatch_on_data_type(to_data_type_id(type),f,FWD(args)...);
+}
+// dispatch on data type strings }
+
+
+// multi-argument dispatch {
+template<class... Ts> struct data_type_list {};
+
+using all_data_types      = data_type_list<C1,I4,I8,R4,R8>;
+using integral_data_types = data_type_list<I4,I8>;
+using floating_data_types = data_type_list<R4,R8>;
+
+namespace detail {
+  template<class T0, class... Ts, class G> auto
+  dispatch_in(data_type_list<T0,Ts...>, data_type_id type, G& g) -> decltype(g(T0{})) {
+    if (type==type_id_of<T0>) return g(T0{});
+    if constexpr (sizeof...(Ts)>0) {
+      return dispatch_in(data_type_list<Ts...>{},type,g);
+    } else {
+      throw cgns_exception("dispatch: data type "+to_string(type)+" is not among the allowed data types");
+    }
   }
-  if (type=="R4") {
-    return f(R4{},FWD(args)...);
+
+  template<class F, class... Tags> auto
+  dispatch_rec(data_type_list<>, F& f, data_type_list<Tags...>) {
+    return f(Tags{}...);
   }
-  if (type=="R8") {
-    return f(R8{},FWD(args)...);
+  template<class R0, class... Rs, class F, class... Tags, class Node_value, class... Node_values> auto
+  dispatch_rec(data_type_list<R0,Rs...>, F& f, data_type_list<Tags...>, const Node_value& x, const Node_values&... xs) {
+    auto dispatch_next = [&f,&xs...]<class T>(T){
+      return dispatch_rec(data_type_list<Rs...>{},f,data_type_list<Tags...,T>{},xs...);
+    };
+    return dispatch_in(R0{},x.type_id(),dispatch_next);
   }
-  throw cgns_exception("dispatch_on_data_type expects a C1, I4, I8, R4 or R8 data_type, but got "+type);
+
+  template<class Restriction, class> using repeat = Restriction;
+
+  template<class... Restrictions> struct restrictions_for {
+    template<class... Node_values> using type = data_type_list<Restrictions...>;
+  };
+  template<> struct restrictions_for<> {
+    template<class... Node_values> using type = data_type_list<repeat<all_data_types,Node_values>...>;
+  };
+  template<class Restriction> struct restrictions_for<Restriction> {
+    template<class... Node_values> using type = data_type_list<repeat<Restriction,Node_values>...>;
+  };
+} // detail
+
+/// Calls `f(T0{},T1{},...)`, where `Ti` is the data type of `xs[i]`
+/// One function is instantiated for each combination of data types:
+///   `Restrictions` can be given to only instantiate some of them, either
+///     - one `data_type_list` for all the arguments,
+///     - or one `data_type_list` per argument.
+///   If the actual data type of an argument is not in its restriction list, an exception is thrown
+// [Sphinx Doc] multi-argument dispatch {
+template<class... Restrictions, class F, class... Node_values> auto
+dispatch(F f, const Node_values&... xs) {
+  static_assert(sizeof...(Restrictions)<=1 || sizeof...(Restrictions)==sizeof...(Node_values),
+                "dispatch: there must be one restriction list for all the arguments, or one per argument");
+  using restrictions = typename detail::restrictions_for<Restrictions...>::template type<Node_values...>;
+  return detail::dispatch_rec(restrictions{},f,data_type_list<>{},xs...);
 }
+// [Sphinx Doc] multi-argument dispatch }
+// multi-argument dispatch }
+
 
 
 
+template<class T> concept Tree_or_node_value =
+     std::is_same_v<std::remove_const_t<T>,tree>
+  || std::is_same_v<std::remove_const_t<T>,node_value>;
 
-inline auto _data_type(const tree      & t) -> std::string { return value(t).data_type(); }
-inline auto _data_type(const node_value& x) -> std::string { return x       .data_type(); }
+inline auto _data_type(const tree      & t) -> data_type_id { return value(t).type_id(); }
+inline auto _data_type(const node_value& x) -> data_type_id { return x       .type_id(); }
 
-template<class F, class T> auto
-// requires T is [const]tree or [const]node_value
+template<class F, Tree_or_node_value T> auto
 dispatch_I4_I8(F f, T& x) {
   auto type = _data_type(x);
   return dispatch_I4_I8(
@@ -76,8 +148,7 @@ dispatch_I4_I8(F f, T& x) {
   );
 }
 
-template<class F, class T> auto
-// requires T is [const]tree or [const]node_value
+template<class F, Tree_or_node_value T> auto
 dispatch_on_data_type(F f, T& x) {
   auto type = _data_type(x);
   return dispatch_on_data_type(
@@ -62,7 +62,7 @@ to_node_value_copy(py::object value) -> node_value {
 
 auto
 to_py_value(node_value& value) -> py::object {
-  if (value.data_type()=="MT") {
+  if (value.type_id()==data_type_id::MT) {
     return py::none{};
   } else {
     return to_np_array(value);
@@ -70,7 +70,7 @@ to_py_value(node_value& value) -> py::object {
 }
 auto
 to_owning_py_value(node_value&& value) -> py::object {
-  if (value.data_type()=="MT") {
+  if (value.type_id()==data_type_id::MT) {
     return py::none{};
   } else if (std_e::cartesian_product_size(value.extent())==0) {
     return to_empty_np_array(value.data_type(),value.extent());
@@ -91,10 +91,11 @@ to_cpp_tree(py::list py_tree) -> tree {
 
   py::list py_children = children(py_tree);
   int n_child = py_children.size();
-  std::vector<tree> children_(n_child);
+  std::vector<tree> children_;
+  children_.reserve(n_child);
   for (int i=0; i<n_child; ++i) {
     py::list py_child = py_children[i];
-    children_[i] = to_cpp_tree(py_child);
+    children_.push_back(to_cpp_tree(py_child));
   }
 
   return {name_,label_,std::move(value_),std::move(children_)};
@@ -107,10 +108,11 @@ to_cpp_tree_copy(py::list py_tree) -> tree {
 
   py::list py_children = children(py_tree);
   int n_child = py_children.size();
-  std::vector<tree> children_(n_child);
+  std::vector<tree> children_;
+  children_.reserve(n_child);
   for (int i=0; i<n_child; ++i) {
     py::list py_child = py_children[i];
-    children_[i] = to_cpp_tree_copy(py_child);
+    children_.push_back(to_cpp_tree_copy(py_child));
   }
 
   return {name_,label_,std::move(value_),std::move(children_)};
@@ -120,9 +122,9 @@ auto
 view_as_py_tree(tree& t) -> py::list {
   auto py_tree = new_py_tree();
 
-  name (py_tree) = name (t);
-  label(py_tree) = label(t);
-  value(py_tree) = to_py_value(value(t));
+  name (py_tree) = to_string(name(t));
+  label(py_tree) = to_string(label(t));
+  value(py_tree) = to_py_value(mutable_value(t));
 
   int n_child = number_of_children(t);
   py::list py_children(n_child);
@@ -144,9 +146,9 @@ to_py_tree(tree&& t) -> py::list {
   // each owner node has its ownership transfered to Python (capsule mechanism)
   auto py_tree = new_py_tree();
 
-  name (py_tree) = name (t);
-  label(py_tree) = label(t);
-  value(py_tree) = to_owning_py_value(std::move(value(t)));
+  name (py_tree) = to_string(name(t));
+  label(py_tree) = to_string(label(t));
+  value(py_tree) = to_owning_py_value(std::move(mutable_value(t)));
 
   int n_child = number_of_children(t);
   py::list py_children(n_child);
@@ -170,7 +172,7 @@ update_py_tree(tree&& t, py::list py_tree) -> void {
 
   bool node_data_was_coming_from_python = same_data(value(t),to_node_value(value(py_tree))); // TODO unit test for MT cases
   if (!node_data_was_coming_from_python) {
-    value(py_tree) = to_owning_py_value(std::move(value(t)));
+    value(py_tree) = to_owning_py_value(std::move(mutable_value(t)));
   }
 
   py::list py_children = children(py_tree);
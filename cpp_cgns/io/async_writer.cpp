@@ -0,0 +1,119 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/io/async_writer.hpp"
+
+
+#include <algorithm>
+#include <chrono>
+
+
+namespace cgns {
+
+
+namespace {
+
+auto
+value_bytes(const tree& t) -> I8 {
+  const node_value& x = value(t);
+  I8 res = x.type_id()==data_type_id::MT ? 0 : x.size()*n_byte(x.type_id());
+  for (const tree& c : children(t)) {
+    res += value_bytes(c);
+  }
+  return res;
+}
+
+} // anonymous
+
+
+async_writer::
+async_writer(write_function write, async_writer_options opts)
+  : write(std::move(write))
+  , opts(opts)
+{
+  int n_threads = std::max(1,opts.n_threads);
+  for (int i=0; i<n_threads; ++i) {
+    workers.emplace_back([this](){ worker_loop(); });
+  }
+}
+
+async_writer::
+~async_writer() {
+  {
+    std::lock_guard lock(mutex);
+    stopping = true;
+  }
+  job_available.notify_all();
+  for (std::thread& w : workers) {
+    w.join();
+  }
+}
+
+auto async_writer::
+save(tree& t, std::string file_name) -> std::future<void> {
+  tree snapshot = opts.deep_copy ? clone(t) : cow_clone(t);
+  I8 n_bytes = value_bytes(snapshot);
+
+  std::unique_lock lock(mutex);
+  job_done.wait(lock,[&](){
+    return stats_.queue_depth==0 || stats_.pending_bytes+n_bytes<=opts.max_pending_bytes;
+  });
+  jobs.push_back(job{std::move(snapshot),std::move(file_name),n_bytes,{}});
+  std::future<void> res = jobs.back().done.get_future();
+  ++stats_.queue_depth;
+  stats_.pending_bytes += n_bytes;
+  lock.unlock();
+
+  job_available.notify_one();
+  return res;
+}
+
+auto async_writer::
+wait() -> void {
+  std::unique_lock lock(mutex);
+  job_done.wait(lock,[this](){ return stats_.queue_depth==0; });
+}
+
+auto async_writer::
+stats() const -> async_writer_stats {
+  std::lock_guard lock(mutex);
+  return stats_;
+}
+
+auto async_writer::
+worker_loop() -> void {
+  while (true) {
+    std::unique_lock lock(mutex);
+    job_available.wait(lock,[this](){ return stopping || !jobs.empty(); });
+    if (jobs.empty()) return; // stopping, and all the snapshots are written
+    job j = std::move(jobs.front());
+    jobs.pop_front();
+    lock.unlock();
+
+    auto start = std::chrono::steady_clock::now();
+    std::exception_ptr error = nullptr;
+    try {
+      write(j.snapshot,j.file_name);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now()-start;
+    j.snapshot = tree(); // release the shared arrays before the snapshot is reported written
+
+    lock.lock();
+    if (!error) {
+      ++stats_.n_written;
+      stats_.bytes_written += j.n_bytes;
+    }
+    stats_.write_time += duration.count();
+    --stats_.queue_depth;
+    stats_.pending_bytes -= j.n_bytes;
+    lock.unlock();
+
+    if (error) j.done.set_exception(error);
+    else j.done.set_value();
+    job_done.notify_all();
+  }
+}
+
+
+} // cgns
+#endif // C++>17
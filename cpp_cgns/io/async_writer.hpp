@@ -0,0 +1,93 @@
+#pragma once
+
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// Asynchronous writing of trees (e.g. solution checkpoints)
+// `save` takes a snapshot of the tree and returns immediately, the snapshot is written by background threads
+// The snapshot is a copy-on-write clone (see `cow_clone`): no array is copied when taking it,
+// and an array is only copied if the original tree is modified (through `value`) before the snapshot is written
+// (unless `async_writer_options::deep_copy` is set)
+
+// [Sphinx Doc] async_writer {
+struct async_writer_options {
+  /// Note: the calls to HDF5 are serialized (see `hdf5::hdf5_lock`), so several threads do not write concurrently with `save_tree`
+  int n_threads = 1;
+  /// bound of the total size of the node values of the snapshots that are not written yet
+  /// `save` blocks until enough of them are written (a snapshot bigger than the bound is written alone)
+  I8 max_pending_bytes = I8(1)<<30;
+  /// if true, the snapshots are deep copies (see `clone`) instead of copy-on-write clones:
+  /// all the arrays are copied by `save`, but the tree can then be modified by any means
+  bool deep_copy = false;
+};
+
+struct async_writer_stats {
+  I8 n_written = 0;
+  I8 bytes_written = 0;
+  /// cumulated time spent writing, in seconds (summed over the threads)
+  double write_time = 0.;
+  /// snapshots waiting to be written, or being written
+  int queue_depth = 0;
+  I8 pending_bytes = 0;
+
+  /// bytes/s
+  auto throughput() const -> double { return write_time>0. ? bytes_written/write_time : 0.; }
+};
+
+class async_writer {
+  public:
+    using write_function = std::function<void(const tree&, const std::string&)>;
+
+    async_writer(write_function write, async_writer_options opts = {});
+    /// waits for all the snapshots to be written
+    ~async_writer();
+    async_writer(const async_writer&) = delete;
+    async_writer& operator=(const async_writer&) = delete;
+
+    /// the future is ready when the snapshot is written, and holds the exception of `write` if it failed
+    /// Precondition (unless `deep_copy`): until the future is ready, the arrays of `t` must only be modified
+    /// through a `value(t)` (or `mutable_value(t)`) obtained after the call to `save`.
+    /// Pointers or views obtained before (e.g. from `data_as` or `view_as_span`) write into the snapshot
+    auto save(tree& t, std::string file_name) -> std::future<void>;
+    /// waits for all the snapshots to be written
+    auto wait() -> void;
+    auto stats() const -> async_writer_stats;
+// [Sphinx Doc] async_writer }
+
+  private:
+    struct job {
+      tree snapshot;
+      std::string file_name;
+      I8 n_bytes;
+      std::promise<void> done;
+    };
+
+    auto worker_loop() -> void;
+
+    write_function write;
+    async_writer_options opts;
+
+    mutable std::mutex mutex;
+    std::condition_variable job_available; // for the workers
+    std::condition_variable job_done; // for `save` and `wait`
+    std::deque<job> jobs;
+    bool stopping = false;
+    async_writer_stats stats_;
+
+    std::vector<std::thread> workers;
+};
+
+
+} // cgns
@@ -0,0 +1,295 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/io/binary_tree.hpp"
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <unistd.h>
+#include "std_e/multi_index/cartesian_product_size.hpp"
+
+
+namespace cgns {
+
+
+namespace {
+
+constexpr char magic[8] = "CGNSBIN";
+constexpr std::uint32_t format_version = 1;
+constexpr std::uint32_t byte_order_mark = 0x01020304;
+constexpr std::uint64_t data_alignment = 64;
+// far deeper than any CGNS tree, but shallow enough for the recursive algorithms on the loaded tree (e.g. its destruction)
+constexpr size_t max_depth = 1024;
+
+struct file_header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t byte_order; // `byte_order_mark`, in the byte order of the machine that wrote the file
+  std::uint64_t n_nodes;
+  std::uint64_t node_table_offset;
+  std::uint64_t dims_offset;
+  std::uint64_t n_dims;
+  std::uint64_t strings_offset;
+  std::uint64_t strings_size;
+};
+static_assert(sizeof(file_header)==64);
+
+struct node_entry {
+  std::uint64_t strings_index; // the name, then the label, in the strings
+  std::uint32_t name_size;
+  std::uint32_t label_size;
+  std::uint8_t data_type;
+  std::uint8_t rank;
+  std::uint16_t padding;
+  std::uint32_t n_children;
+  std::uint64_t dims_index;
+  std::uint64_t data_offset; // from the start of the file
+  std::uint64_t data_size; // in bytes
+};
+static_assert(sizeof(node_entry)==48);
+
+constexpr auto
+aligned(std::uint64_t offset) -> std::uint64_t {
+  return (offset+data_alignment-1)/data_alignment*data_alignment;
+}
+
+
+// save {
+struct file_layout {
+  std::vector<const tree*> nodes; // preorder
+  std::vector<node_entry> entries;
+  std::vector<I8> dims;
+  std::string strings;
+  file_header header;
+};
+
+auto
+append_nodes(const tree& t, std::vector<const tree*>& nodes) -> void {
+  nodes.push_back(&t);
+  for (const tree& c : children(t)) {
+    append_nodes(c,nodes);
+  }
+}
+
+auto
+compute_layout(const tree& t) -> file_layout {
+  file_layout l;
+  append_nodes(t,l.nodes);
+
+  for (const tree* n : l.nodes) {
+    const node_value& x = value(*n);
+    node_entry e = {};
+    e.strings_index = l.strings.size();
+    e.name_size = name(*n).size();
+    l.strings += name(*n).str();
+    std::string_view label_str = label(*n).str();
+    e.label_size = label_str.size();
+    l.strings += label_str;
+
+    e.data_type = std::uint8_t(x.type_id());
+    e.n_children = children(*n).size();
+    e.dims_index = l.dims.size();
+    if (x.type_id()!=data_type_id::MT) {
+      std::vector<I8> dims = x.extent();
+      if (dims.size()>255) throw cgns_exception("save_binary_tree: rank of node \""+std::string(name(*n).str())+"\" is too high");
+      e.rank = dims.size();
+      l.dims.insert(end(l.dims),begin(dims),end(dims));
+      e.data_size = std_e::cartesian_product_size(dims)*n_byte(x.type_id());
+    }
+    l.entries.push_back(e);
+  }
+
+  file_header& h = l.header;
+  std::memcpy(h.magic,magic,sizeof(magic));
+  h.version = format_version;
+  h.byte_order = byte_order_mark;
+  h.n_nodes = l.entries.size();
+  h.node_table_offset = sizeof(file_header);
+  h.dims_offset = h.node_table_offset + h.n_nodes*sizeof(node_entry);
+  h.n_dims = l.dims.size();
+  h.strings_offset = h.dims_offset + h.n_dims*sizeof(I8);
+  h.strings_size = l.strings.size();
+
+  std::uint64_t offset = aligned(h.strings_offset+h.strings_size);
+  for (node_entry& e : l.entries) {
+    if (e.data_size==0) continue; // data_offset==0: empty arrays point to the start of the file
+    e.data_offset = offset;
+    offset = aligned(offset+e.data_size);
+  }
+  return l;
+}
+
+auto
+write_padding(std::ofstream& f, std::uint64_t& pos, std::uint64_t next) -> void {
+  static constexpr char zeros[data_alignment] = {};
+  f.write(zeros,next-pos);
+  pos = next;
+}
+
+/// in the same directory as `file_name`, so that it can be renamed to it
+auto
+temporary_file_name(const std::string& file_name) -> std::string {
+  return file_name+".tmp."+std::to_string(::getpid())+"."+std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+}
+
+} // anonymous
+
+auto
+save_binary_tree(const tree& t, const std::string& file_name) -> void {
+  file_layout l = compute_layout(t);
+
+  // written to a temporary file, then renamed: a tree still mapped from the previous `file_name` keeps its file
+  // (truncating the file in place would make the accesses to its mapping fail with SIGBUS)
+  std::string tmp_name = temporary_file_name(file_name);
+  std::ofstream f(tmp_name,std::ios::binary|std::ios::trunc);
+  if (!f) throw cgns_exception("save_binary_tree: unable to create file \""+tmp_name+"\"");
+  f.write(reinterpret_cast<const char*>(&l.header),sizeof(file_header));
+  f.write(reinterpret_cast<const char*>(l.entries.data()),l.entries.size()*sizeof(node_entry));
+  f.write(reinterpret_cast<const char*>(l.dims.data()),l.dims.size()*sizeof(I8));
+  f.write(l.strings.data(),l.strings.size());
+
+  std::uint64_t pos = l.header.strings_offset+l.header.strings_size;
+  for (size_t i=0; i<l.nodes.size(); ++i) {
+    const node_entry& e = l.entries[i];
+    if (e.data_size==0) continue;
+    write_padding(f,pos,e.data_offset);
+    f.write(reinterpret_cast<const char*>(value(*l.nodes[i]).data()),e.data_size); // the arrays are written directly, without copy
+    pos += e.data_size;
+  }
+
+  f.close();
+  if (!f) {
+    std::remove(tmp_name.c_str());
+    throw cgns_exception("save_binary_tree: unable to write file \""+tmp_name+"\"");
+  }
+  if (std::rename(tmp_name.c_str(),file_name.c_str())!=0) {
+    std::remove(tmp_name.c_str());
+    throw cgns_exception("save_binary_tree: unable to replace file \""+file_name+"\"");
+  }
+}
+// save }
+
+
+// load {
+namespace {
+
+struct file_reader {
+  std::shared_ptr<file_mapping> mapping;
+  std::string file_name;
+  file_header header;
+
+  auto
+  check(bool cond, const std::string& what) const -> void {
+    if (!cond) throw cgns_exception("load_binary_tree: file \""+file_name+"\" is corrupted ("+what+")");
+  }
+  auto
+  check_region(std::uint64_t offset, std::uint64_t size, const std::string& what) const -> void {
+    check(offset<=(std::uint64_t)mapping->size() && size<=mapping->size()-offset,what+" out of the file");
+  }
+
+  auto
+  entry(std::uint64_t i) const -> node_entry {
+    node_entry e;
+    std::memcpy(&e,mapping->data()+header.node_table_offset+i*sizeof(node_entry),sizeof(node_entry));
+    return e;
+  }
+  auto
+  dim(std::uint64_t i) const -> I8 {
+    I8 d;
+    std::memcpy(&d,mapping->data()+header.dims_offset+i*sizeof(I8),sizeof(I8));
+    return d;
+  }
+  auto
+  string(std::uint64_t index, std::uint64_t size) const -> std::string_view {
+    check(index<=header.strings_size && size<=header.strings_size-index,"string out of the string table");
+    return std::string_view(reinterpret_cast<const char*>(mapping->data())+header.strings_offset+index,size);
+  }
+};
+
+auto
+read_value(const file_reader& r, const node_entry& e) -> node_value {
+  r.check(e.data_type<=std::uint8_t(data_type_id::R8),"unknown data type");
+  data_type_id type = data_type_id(e.data_type);
+  if (type==data_type_id::MT) return MT();
+
+  r.check(e.dims_index<=r.header.n_dims && e.rank<=r.header.n_dims-e.dims_index,"dimensions out of the dimension table");
+  std::vector<I8> dims(e.rank);
+  for (int k=0; k<e.rank; ++k) {
+    dims[k] = r.dim(e.dims_index+k);
+    r.check(dims[k]>=0,"negative dimension");
+  }
+  r.check(std::uint64_t(std_e::cartesian_product_size(dims)*n_byte(type))==e.data_size,"data size not matching the dimensions");
+  r.check(e.data_offset%data_alignment==0,"unaligned data");
+  r.check_region(e.data_offset,e.data_size,"data");
+  return make_mapped_node_value(r.mapping,type,e.data_offset,std::move(dims));
+}
+
+struct pending_node {
+  tree node;
+  std::uint32_t n_children_left;
+};
+
+/// the nodes are in preorder: each node is completed by its `n_children` following sub-trees
+/// iterative: the depth of the tree comes from the file, and could overflow the call stack
+auto
+read_tree(const file_reader& r) -> tree {
+  std::vector<pending_node> stack;
+  std::uint64_t i = 0;
+  while (true) {
+    r.check(i<r.header.n_nodes,"more children than nodes");
+    node_entry e = r.entry(i++);
+    r.check(e.name_size<=node_name::max_size,"name too long");
+    std::string_view name_str = r.string(e.strings_index,e.name_size);
+    std::string_view label_str = r.string(e.strings_index+e.name_size,e.label_size);
+    stack.push_back({tree(node_name(name_str),node_label(label_str),read_value(r,e)),e.n_children});
+    r.check(stack.size()<=max_depth,"tree too deep");
+
+    // the complete nodes are moved into their parent
+    while (stack.back().n_children_left==0) {
+      if (stack.size()==1) {
+        r.check(i==r.header.n_nodes,"nodes out of the tree");
+        return std::move(stack.back().node);
+      }
+      tree c = std::move(stack.back().node);
+      stack.pop_back();
+      emplace_child(stack.back().node,std::move(c));
+      --stack.back().n_children_left;
+    }
+  }
+}
+
+} // anonymous
+
+auto
+load_binary_tree(const std::string& file_name, mapping_mode mode) -> tree {
+  file_reader r = {map_file(file_name,mode),file_name,{}};
+
+  r.check_region(0,sizeof(file_header),"header");
+  std::memcpy(&r.header,r.mapping->data(),sizeof(file_header));
+  const file_header& h = r.header;
+  if (std::memcmp(h.magic,magic,sizeof(magic))!=0) {
+    throw cgns_exception("load_binary_tree: file \""+file_name+"\" is not a binary tree file");
+  }
+  if (h.version!=format_version) {
+    throw cgns_exception("load_binary_tree: file \""+file_name+"\" has format version "+std::to_string(h.version)+", expected "+std::to_string(format_version));
+  }
+  if (h.byte_order!=byte_order_mark) {
+    throw cgns_exception("load_binary_tree: file \""+file_name+"\" was written on a machine of another byte order");
+  }
+  r.check(h.n_nodes>0,"no node");
+  r.check(h.n_nodes<=(std::uint64_t)r.mapping->size()/sizeof(node_entry),"node table too big");
+  r.check_region(h.node_table_offset,h.n_nodes*sizeof(node_entry),"node table");
+  r.check(h.n_dims<=(std::uint64_t)r.mapping->size()/sizeof(I8),"dimension table too big");
+  r.check_region(h.dims_offset,h.n_dims*sizeof(I8),"dimension table");
+  r.check_region(h.strings_offset,h.strings_size,"string table");
+
+  return read_tree(r);
+}
+// load }
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,31 @@
+#pragma once
+
+
+#include <string>
+#include "cpp_cgns/base/tree.hpp"
+#include "cpp_cgns/base/file_mapping.hpp"
+
+
+namespace cgns {
+
+
+// Native binary format of trees
+// Meant for scratch, cache and inter-process files, where the metadata overhead of HDF5 is too high:
+// the file is written in the byte order of the machine, and is not meant to be archived
+// Layout:
+//   - a 64-byte header
+//   - the node table: one fixed-size entry per node, in preorder (name, label, data type, dimensions, data offset)
+//   - the dimensions and the strings referred to by the node table
+//   - the data section: the array of each node, aligned on 64 bytes
+// Loading maps the file into memory: the node values point into the mapping, no array is read or copied
+
+// [Sphinx Doc] binary tree files {
+/// the file is written aside, then renamed to `file_name`: trees loaded from a previous `file_name` are not affected
+auto save_binary_tree(const tree& t, const std::string& file_name) -> void;
+/// with `mapping_mode::copy_on_write`, the node values can be modified (the file is not)
+/// with `mapping_mode::read_only`, they must not be
+auto load_binary_tree(const std::string& file_name, mapping_mode mode = mapping_mode::copy_on_write) -> tree;
+// [Sphinx Doc] binary tree files }
+
+
+} // cgns
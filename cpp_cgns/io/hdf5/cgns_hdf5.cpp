@@ -0,0 +1,320 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/io/hdf5/cgns_hdf5.hpp"
+
+
+#include <filesystem>
+#include <map>
+#include <optional>
+#include "std_e/multi_index/cartesian_product_size.hpp"
+#include "cpp_cgns/base/allocation_policy.hpp"
+#include "cpp_cgns/dispatch.hpp"
+#include "cpp_cgns/compiled_path.hpp"
+#include "cpp_cgns/io/hdf5/hdf5_utils.hpp"
+#include "cpp_cgns/io/hdf5/lazy_dataset_array.hpp"
+
+
+namespace cgns {
+
+
+using namespace hdf5;
+
+
+// load {
+namespace {
+
+constexpr int max_link_depth = 32; // protects against cyclic links
+
+/// include/exclude filters of the nodes (see `load_options`)
+class path_filter {
+  public:
+    path_filter(const load_options& opts) {
+      for (const auto& p : opts.include) include.emplace_back(p);
+      for (const auto& p : opts.exclude) exclude.emplace_back(p);
+    }
+
+    /// state of the matching of the path from the root to a node
+    struct state {
+      int depth;
+      bool fully_included;
+      std::vector<int> include_candidates; // patterns whose first `depth` components match the path
+      std::vector<int> exclude_candidates;
+    };
+
+    auto
+    root_state() const -> state {
+      state s = {0,include.empty(),{},{}};
+      for (int i=0; i<(int)include.size(); ++i) s.include_candidates.push_back(i);
+      for (int i=0; i<(int)exclude.size(); ++i) s.exclude_candidates.push_back(i);
+      return s;
+    }
+
+    /// returns the state of child `c` of a node of state `s`, or nothing if `c` must not be loaded
+    auto
+    child_state(const state& s, const tree& c) const -> std::optional<state> {
+      state cs = {s.depth+1,s.fully_included,{},{}};
+      if (!cs.fully_included) {
+        for (int i : s.include_candidates) {
+          if (include[i][s.depth].matches(c)) {
+            if (include[i].size()==cs.depth) cs.fully_included = true;
+            else cs.include_candidates.push_back(i);
+          }
+        }
+        if (!cs.fully_included && cs.include_candidates.empty()) return {};
+      }
+      for (int i : s.exclude_candidates) {
+        if (exclude[i][s.depth].matches(c)) {
+          if (exclude[i].size()==cs.depth) return {};
+          cs.exclude_candidates.push_back(i);
+        }
+      }
+      return cs;
+    }
+    /// true if a child of name `n` of a node of state `s` must not be loaded, whatever its label
+    auto
+    excludes_by_name(const state& s, const node_name& n) const -> bool {
+      for (int i : s.exclude_candidates) {
+        if (exclude[i].size()==s.depth+1 && exclude[i][s.depth].matches_name(n)) return true;
+      }
+      return false;
+    }
+  private:
+    std::vector<compiled_path> include;
+    std::vector<compiled_path> exclude;
+};
+
+struct reader {
+  const load_options* opts;
+  const path_filter* filter;
+  std::shared_ptr<const hdf5_handle> file;
+  std::filesystem::path file_path;
+  int link_depth;
+};
+
+auto
+read_value(hid_t group, data_type_id type, const reader& r) -> node_value {
+  if (type==data_type_id::MT) return MT();
+  hdf5_handle ds(H5Dopen2(group,data_dataset_name,H5P_DEFAULT),H5Dclose,"unable to open the data of a node");
+  std::vector<I8> dims = dataset_dims(ds);
+  I8 n = std_e::cartesian_product_size(dims);
+  return dispatch_on_data_type(
+    type,
+    [&]<class T>(T) -> node_value {
+      if (r.opts->skeleton && n > r.opts->skeleton_threshold) {
+        return node_value(lazy_dataset_array<T>(r.file,object_path(ds),n),std::move(dims));
+      }
+      aligned_array<T> arr(n);
+      check(H5Dread(ds,native_type(type),H5S_ALL,H5S_ALL,H5P_DEFAULT,arr.data()),"unable to read the data of a node");
+      return node_value(std::move(arr),std::move(dims));
+    }
+  );
+}
+
+/// group of a node, and the reader of its file
+struct node_group {
+  hdf5_handle group;
+  reader r;
+};
+
+/// follows the links until an actual node is found
+auto
+resolve_links(hdf5_handle&& group, const std::string& name_str, const reader& r) -> node_group {
+  node_group res = {std::move(group),r};
+  while (read_string_attribute(res.group,"type")=="LK") {
+    if (res.r.link_depth>=max_link_depth) {
+      throw cgns_exception("load_tree: too many nested links from node \""+name_str+"\" of file \""+r.file_path.string()+"\"");
+    }
+    std::string target_file;
+    if (has_link(res.group,link_file_dataset_name)) target_file = read_string_dataset(res.group,link_file_dataset_name);
+    std::string target_path = read_string_dataset(res.group,link_path_dataset_name);
+
+    reader target_r = {res.r.opts,res.r.filter,res.r.file,res.r.file_path,res.r.link_depth+1};
+    if (!target_file.empty()) {
+      target_r.file_path = res.r.file_path.parent_path()/target_file;
+      target_r.file = std::make_shared<const hdf5_handle>(
+        H5Fopen(target_r.file_path.c_str(),H5F_ACC_RDONLY,H5P_DEFAULT),H5Fclose,"unable to open linked file \""+target_r.file_path.string()+"\""
+      );
+    }
+    hdf5_handle target(H5Gopen2(*target_r.file,target_path.c_str(),H5P_DEFAULT),H5Gclose,"unable to open linked node \""+target_path+"\" in \""+target_r.file_path.string()+"\"");
+    res = node_group{std::move(target),std::move(target_r)};
+  }
+  return res;
+}
+
+auto read_node(hid_t group, tree& t, const path_filter::state& s, const reader& r) -> void;
+
+auto
+read_children(hid_t group, tree& t, const path_filter::state& s, const reader& r) -> void {
+  for (const std::string& child_name : link_names(group)) {
+    if (child_name.empty() || child_name[0]==' ') continue; // not a CGNS node
+    hdf5_handle child(H5Gopen2(group,child_name.c_str(),H5P_DEFAULT),H5Gclose,"unable to open node \""+child_name+"\"");
+
+    // a link node is loaded as the node it refers to, but with its own name
+    std::string name_str = read_string_attribute(child,"name");
+    node_name c_name(name_str);
+    if (r.filter->excludes_by_name(s,c_name)) continue; // checked before following the links: an excluded link may be broken
+
+    std::optional<node_group> c_group;
+    try {
+      c_group = resolve_links(std::move(child),name_str,r);
+    } catch (const cgns_exception&) {
+      // a broken link has no label: it is only an error if the node is included without one
+      if (r.filter->child_state(s,tree(c_name,node_label(),MT()))) throw;
+      continue;
+    }
+    tree c(c_name,read_string_attribute(c_group->group,"label"),MT());
+
+    auto cs = r.filter->child_state(s,c);
+    if (cs) {
+      read_node(c_group->group,c,*cs,c_group->r);
+      emplace_child(t,std::move(c));
+    }
+  }
+}
+
+/// `t` has the name and label of the node, its value and children are read
+auto
+read_node(hid_t group, tree& t, const path_filter::state& s, const reader& r) -> void {
+  data_type_id type = to_data_type_id(read_string_attribute(group,"type"));
+  set_value(t,read_value(group,type,r));
+  read_children(group,t,s,r);
+}
+
+} // anonymous
+
+auto
+load_tree(const std::string& file_name, const load_options& opts) -> tree {
+  hdf5_lock lock;
+  auto file = std::make_shared<const hdf5_handle>(H5Fopen(file_name.c_str(),H5F_ACC_RDONLY,H5P_DEFAULT),H5Fclose,"unable to open file \""+file_name+"\"");
+  return load_tree(std::move(file),file_name,opts);
+}
+
+auto
+load_tree(std::shared_ptr<const hdf5_handle> file, const std::string& file_name, const load_options& opts) -> tree {
+  hdf5_lock lock;
+  hdf5_handle root(H5Gopen2(*file,"/",H5P_DEFAULT),H5Gclose,"unable to open the root group of \""+file_name+"\"");
+
+  path_filter filter(opts);
+  reader r = {&opts,&filter,file,file_name,0};
+  tree t("CGNSTree","CGNSTree_t",MT());
+  read_children(root,t,filter.root_state(),r);
+  return t;
+}
+// load }
+
+
+// save {
+namespace {
+
+using links_by_path = std::map<std::string,const link_spec*>;
+
+auto
+normalized_path(const std::string& path) -> std::string {
+  size_t first = path.find_first_not_of('/');
+  if (first==std::string::npos) return "";
+  size_t last = path.find_last_not_of('/');
+  return path.substr(first,last-first+1);
+}
+
+auto
+write_flags(hid_t obj) -> void {
+  I4 flags = 1; // as the CGNS library: the creation order of the children is tracked
+  hsize_t n = 1;
+  hdf5_handle space(H5Screate_simple(1,&n,nullptr),H5Sclose,"unable to create dataspace");
+  hdf5_handle attr(H5Acreate2(obj,"flags",file_type(data_type_id::I4),space,H5P_DEFAULT,H5P_DEFAULT),H5Aclose,"unable to create attribute \"flags\"");
+  check(H5Awrite(attr,native_type(data_type_id::I4),&flags),"unable to write attribute \"flags\"");
+}
+
+auto
+write_node_attributes(hid_t group, const std::string& name_str, const std::string& label_str, const std::string& type) -> void {
+  write_string_attribute(group,"name" ,name_str ,name_attribute_size);
+  write_string_attribute(group,"label",label_str,label_attribute_size);
+  write_string_attribute(group,"type" ,type      ,type_attribute_size);
+  write_flags(group);
+}
+
+auto
+write_value(hid_t group, const node_value& x) -> void {
+  data_type_id type = x.type_id();
+  if (type==data_type_id::MT) return;
+  std::vector<I8> dims = x.extent();
+  std::vector<hsize_t> h5_dims(dims.rbegin(),dims.rend()); // HDF5 is C-ordered, CGNS is Fortran-ordered
+  hdf5_handle space(H5Screate_simple(h5_dims.size(),h5_dims.data(),nullptr),H5Sclose,"unable to create dataspace");
+  hdf5_handle ds(
+    H5Dcreate2(group,data_dataset_name,file_type(type),space,H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT),
+    H5Dclose,"unable to create the data of a node"
+  );
+  check(H5Dwrite(ds,native_type(type),H5S_ALL,H5S_ALL,H5P_DEFAULT,x.data()),"unable to write the data of a node");
+}
+
+auto
+write_link(hid_t parent, const tree& t, const link_spec& link) -> void {
+  std::string name_str = name(t).str();
+  hdf5_handle gcpl = group_creation_properties();
+  hdf5_handle group(H5Gcreate2(parent,name_str.c_str(),H5P_DEFAULT,gcpl,H5P_DEFAULT),H5Gclose,"unable to create link node \""+name_str+"\"");
+  write_node_attributes(group,name_str,"","LK");
+  write_string_dataset(group,link_path_dataset_name,link.target_path);
+  if (link.target_file.empty()) {
+    check(H5Lcreate_soft(link.target_path.c_str(),group,link_name,H5P_DEFAULT,H5P_DEFAULT),"unable to create link of node \""+name_str+"\"");
+  } else {
+    write_string_dataset(group,link_file_dataset_name,link.target_file);
+    check(H5Lcreate_external(link.target_file.c_str(),link.target_path.c_str(),group,link_name,H5P_DEFAULT,H5P_DEFAULT),"unable to create link of node \""+name_str+"\"");
+  }
+}
+
+auto
+write_node(hid_t parent, const tree& t, const std::string& path, const links_by_path& links) -> void {
+  if (auto it = links.find(path); it!=links.end()) {
+    write_link(parent,t,*it->second);
+    return;
+  }
+
+  std::string name_str = name(t).str();
+  hdf5_handle gcpl = group_creation_properties();
+  hdf5_handle group(H5Gcreate2(parent,name_str.c_str(),H5P_DEFAULT,gcpl,H5P_DEFAULT),H5Gclose,"unable to create node \""+path+"\"");
+  write_node_attributes(group,name_str,label(t).str(),value(t).data_type());
+  write_value(group,value(t));
+  for (const tree& c : children(t)) {
+    write_node(group,c,path+"/"+name(c).str(),links);
+  }
+}
+
+auto
+write_root_attributes(hid_t root) -> void {
+  write_node_attributes(root,"HDF5 MotherNode","Root Node of HDF5 File","MT");
+  write_string_dataset(root," format","IEEE_LITTLE_32");
+
+  unsigned major, minor, release;
+  check(H5get_libversion(&major,&minor,&release),"unable to get the HDF5 version");
+  std::string version = "HDF5 Version "+std::to_string(major)+"."+std::to_string(minor)+"."+std::to_string(release);
+  write_string_dataset(root," hdf5version",version);
+}
+
+} // anonymous
+
+auto
+save_tree(const tree& t, const std::string& file_name, const std::vector<link_spec>& links) -> void {
+  hdf5_lock lock; // e.g. several threads of an `async_writer`
+  links_by_path links_map;
+  for (const link_spec& link : links) {
+    links_map[normalized_path(link.node_path)] = &link;
+  }
+
+  hdf5_handle fcpl(H5Pcreate(H5P_FILE_CREATE),H5Pclose,"unable to create file properties");
+  check(H5Pset_link_creation_order(fcpl,H5P_CRT_ORDER_TRACKED|H5P_CRT_ORDER_INDEXED),"unable to set link creation order");
+  hdf5_handle file(H5Fcreate(file_name.c_str(),H5F_ACC_TRUNC,fcpl,H5P_DEFAULT),H5Fclose,"unable to create file \""+file_name+"\"");
+  hdf5_handle root(H5Gopen2(file,"/",H5P_DEFAULT),H5Gclose,"unable to open the root group of \""+file_name+"\"");
+  write_root_attributes(root);
+
+  if (label(t)=="CGNSTree_t") {
+    for (const tree& c : children(t)) {
+      write_node(root,c,name(c).str(),links_map);
+    }
+  } else {
+    write_node(root,t,name(t).str(),links_map);
+  }
+}
+// save }
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,59 @@
+#pragma once
+
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+namespace hdf5 { class hdf5_handle; }
+
+
+// Native CGNS/HDF5 reading and writing
+// The layout is that of the CGNS library (see https://cgns.github.io/CGNS_docs_current/filemap/figures/hdf5.html):
+//   - each node is an HDF5 group, with attributes "name", "label", "type" and "flags"
+//   - its value, if any, is the dataset " data", with reversed dimensions (HDF5 is C-ordered)
+//   - its children are its sub-groups, in creation order
+
+/// node of the written tree that is replaced by a link to a node of another (or the same) file
+struct link_spec {
+  /// path of the node in the tree, from the root (e.g. "Base/Zone/GridCoordinates")
+  std::string node_path;
+  /// file of the linked node, relative to the directory of the written file (empty: same file)
+  std::string target_file;
+  /// path of the linked node in `target_file`
+  std::string target_path;
+};
+
+// [Sphinx Doc] load_options {
+struct load_options {
+  /// if not empty, only the nodes along these generalized paths, and the sub-trees of the matching nodes, are loaded
+  std::vector<std::string> include = {};
+  /// the nodes matching these generalized paths, and their sub-trees, are not loaded
+  std::vector<std::string> exclude = {};
+  /// if true, the values with more than `skeleton_threshold` elements are not read when loading the tree,
+  /// but only when their data is first accessed (e.g. by `data_as` or `view_as_span`)
+  bool skeleton = false;
+  I8 skeleton_threshold = 100;
+};
+// [Sphinx Doc] load_options }
+
+// [Sphinx Doc] CGNS/HDF5 {
+/// returns a tree whose root is a "CGNSTree" node, and whose children are the top-level nodes of the file
+/// the values are directly read into the node value arrays
+/// links are followed: a link node is loaded as the node it refers to (with the name of the link node)
+auto load_tree(const std::string& file_name, const load_options& opts = {}) -> tree;
+/// same, from a file already opened (e.g. with specific access properties)
+auto load_tree(std::shared_ptr<const hdf5::hdf5_handle> file, const std::string& file_name, const load_options& opts = {}) -> tree;
+
+/// if `t` is a CGNSTree_t, its children are the top-level nodes of the file, else `t` is the only top-level node
+/// the file is overwritten if it already exists
+auto save_tree(const tree& t, const std::string& file_name, const std::vector<link_spec>& links = {}) -> void;
+// [Sphinx Doc] CGNS/HDF5 }
+
+
+} // cgns
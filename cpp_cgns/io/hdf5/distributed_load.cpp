@@ -0,0 +1,324 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/io/hdf5/distributed_load.hpp"
+
+
+#include <algorithm>
+#include <utility>
+#include "std_e/multi_index/cartesian_product_size.hpp"
+#include "cpp_cgns/base/allocation_policy.hpp"
+#include "cpp_cgns/dispatch.hpp"
+#include "cpp_cgns/tree_manip.hpp"
+#include "cpp_cgns/sids/creation.hpp"
+#include "cpp_cgns/sids/utils.hpp"
+#include "cpp_cgns/io/hdf5/cgns_hdf5.hpp"
+#include "cpp_cgns/io/hdf5/hdf5_utils.hpp"
+
+
+namespace cgns {
+
+
+using namespace hdf5;
+
+
+auto
+uniform_distribution(I8 n_total, int i_rank, int n_rank) -> std::vector<I8> {
+  I8 n_by_rank = n_total/n_rank;
+  I8 n_remaining = n_total%n_rank;
+  I8 start = i_rank*n_by_rank + std::min<I8>(i_rank,n_remaining);
+  I8 end = start + n_by_rank + (i_rank<n_remaining ? 1 : 0);
+  return {start,end,n_total};
+}
+
+
+namespace {
+
+const std::string distribution_name = ":CGNS#Distribution";
+
+struct block_reader {
+  hid_t file;
+  hid_t dxpl; // H5P_DEFAULT, or collective MPI-IO transfer
+  int i_rank;
+  int n_rank;
+};
+
+/// HDF5 path of the data of the node at `node_path`, through the link nodes
+auto
+data_path(hid_t file, const std::vector<std::string>& node_path) -> std::string {
+  std::string res;
+  for (const std::string& name_str : node_path) {
+    res += "/"+name_str;
+    hdf5_handle group(H5Gopen2(file,res.c_str(),H5P_DEFAULT),H5Gclose,"unable to open node \""+res+"\"");
+    while (read_string_attribute(group,"type")=="LK") {
+      res += std::string("/")+link_name; // HDF5 follows the soft and external links
+      group = hdf5_handle(H5Gopen2(file,res.c_str(),H5P_DEFAULT),H5Gclose,"unable to open linked node \""+res+"\"");
+    }
+  }
+  return res+"/"+data_dataset_name;
+}
+
+/// reads the rows [start,end) of the slowest dimension of the dataset (the last one in CGNS order)
+auto
+read_block(const block_reader& br, const std::string& path, data_type_id type, I8 start, I8 end) -> node_value {
+  hdf5_handle ds(H5Dopen2(br.file,path.c_str(),H5P_DEFAULT),H5Dclose,"unable to open dataset \""+path+"\"");
+  hdf5_handle file_space(H5Dget_space(ds),H5Sclose,"unable to get dataspace");
+  int rank = H5Sget_simple_extent_ndims(file_space);
+  check(rank,"unable to get dataspace rank");
+  std::vector<hsize_t> h5_dims(rank);
+  check(H5Sget_simple_extent_dims(file_space,h5_dims.data(),nullptr),"unable to get dataspace dimensions");
+  if (rank==0 || start<0 || start>end || end>(I8)h5_dims[0]) {
+    throw cgns_exception(
+      "load_distributed_tree: block ["+std::to_string(start)+","+std::to_string(end)+") is out of the bounds of \""+path+"\""
+    );
+  }
+
+  std::vector<hsize_t> offset(rank,0);
+  offset[0] = start;
+  std::vector<hsize_t> count = h5_dims;
+  count[0] = end-start;
+  hdf5_handle mem_space(H5Screate_simple(rank,count.data(),nullptr),H5Sclose,"unable to create dataspace");
+  if (count[0]==0) { // the process must still take part in a collective read
+    check(H5Sselect_none(file_space),"unable to select an empty block");
+    check(H5Sselect_none(mem_space),"unable to select an empty block");
+  } else {
+    check(H5Sselect_hyperslab(file_space,H5S_SELECT_SET,offset.data(),nullptr,count.data(),nullptr),"unable to select block of \""+path+"\"");
+  }
+
+  std::vector<I8> dims(count.rbegin(),count.rend());
+  I8 n = std_e::cartesian_product_size(dims);
+  return dispatch_on_data_type(
+    type,
+    [&]<class T>(T) -> node_value {
+      aligned_array<T> arr(n);
+      check(H5Dread(ds,native_type(type),mem_space,file_space,br.dxpl,arr.data()),"unable to read block of \""+path+"\"");
+      return node_value(std::move(arr),std::move(dims));
+    }
+  );
+}
+
+auto
+integer_values(const node_value& x) -> std::vector<I8> {
+  return dispatch_I4_I8(
+    [](auto i, const node_value& x){
+      using I = decltype(i);
+      const I* p = data_as<I>(x);
+      return std::vector<I8>(p,p+x.size());
+    },
+    x
+  );
+}
+
+/// distribution of `entity` given by the ":CGNS#Distribution" child of `t`, or `default_dist` if there is none
+auto
+distribution(const tree& t, const std::string& entity, std::vector<I8> default_dist) -> std::vector<I8> {
+  if (!has_child_of_name(t,distribution_name)) return default_dist;
+  const tree& dist = get_child_by_name(t,distribution_name);
+  if (!has_child_of_name(dist,entity)) return default_dist;
+  std::vector<I8> res = integer_values(value(get_child_by_name(dist,entity)));
+  if (res.size()!=3 || res[0]<0 || res[0]>res[1] || res[1]>res[2]) {
+    throw cgns_exception("load_distributed_tree: \""+entity+"\" distribution of node \""+name(t).str()+"\" is invalid");
+  }
+  return res;
+}
+/// adds `dist` as the distribution of `entity` to `t`, if it has none
+/// only called once an array was loaded by block: the other arrays are whole on each process
+auto
+record_distribution(tree& t, const std::string& entity, const std::vector<I8>& dist) -> void {
+  if (!has_child_of_name(t,distribution_name)) {
+    emplace_child(t,new_Distribution(entity,std::vector<I8>(dist)));
+    return;
+  }
+  tree& dist_node = get_child_by_name(t,distribution_name);
+  if (!has_child_of_name(dist_node,entity)) {
+    emplace_child(dist_node,new_DataArray(entity,std::vector<I8>(dist)));
+  }
+}
+
+/// replaces the value of the one-dimensional array `c` by its block [dist[0],dist[1])
+/// returns false if `c` is not one-dimensional (it is then left whole)
+auto
+load_block(tree& c, std::vector<std::string>& path, const std::vector<I8>& dist, const block_reader& br) -> bool {
+  const node_value& x = value(std::as_const(c));
+  if (x.type_id()==data_type_id::MT || x.rank()!=1) return false;
+  if (x.extent(0)!=dist[2]) {
+    throw cgns_exception(
+      "load_distributed_tree: array \""+name(c).str()+"\" has "+std::to_string(x.extent(0))
+     +" elements, but its distribution is over "+std::to_string(dist[2])+" elements"
+    );
+  }
+  path.push_back(name(c).str());
+  set_value(c,read_block(br,data_path(br.file,path),x.type_id(),dist[0],dist[1]));
+  path.pop_back();
+  return true;
+}
+
+/// returns true if at least one array was loaded by block
+auto
+load_data_array_blocks(tree& t, std::vector<std::string>& path, const std::vector<I8>& dist, const block_reader& br) -> bool {
+  bool loaded = false;
+  path.push_back(name(t).str());
+  for (tree& c : get_children_by_label(t,"DataArray_t")) {
+    loaded = load_block(c,path,dist,br) || loaded;
+  }
+  path.pop_back();
+  return loaded;
+}
+
+auto
+load_element_blocks(tree& e, std::vector<std::string>& path, const block_reader& br) -> void {
+  std::vector<I8> elt_dist = distribution(e,"Element",uniform_distribution(nb_of_elements(e),br.i_rank,br.n_rank));
+
+  path.push_back(name(e).str());
+  tree& connec = get_child_by_name(e,"ElementConnectivity");
+  const node_value& connec_val = value(std::as_const(connec));
+  bool loaded = false;
+  std::vector<I8> connec_dist;
+  if (has_child_of_name(e,"ElementStartOffset")) { // NGON_n, NFACE_n, MIXED
+    tree& eso = get_child_by_name(e,"ElementStartOffset");
+    std::vector<I8> eso_dist = {elt_dist[0],elt_dist[1]+1,elt_dist[2]+1};
+    if (load_block(eso,path,eso_dist,br)) {
+      loaded = true;
+      std::vector<I8> offsets = integer_values(value(std::as_const(eso))); // global offsets: not renumbered
+      connec_dist = distribution(e,"ElementConnectivity",{offsets.front(),offsets.back(),connec_val.extent(0)});
+      if (!load_block(connec,path,connec_dist,br)) connec_dist.clear();
+    }
+  } else {
+    I8 n_vtx = number_of_vertices(element_type(e));
+    if (n_vtx>0) {
+      loaded = load_block(connec,path,{n_vtx*elt_dist[0],n_vtx*elt_dist[1],n_vtx*elt_dist[2]},br);
+    } // else: variable-size elements without offsets, can't be distributed
+  }
+  path.pop_back();
+
+  if (loaded) record_distribution(e,"Element",elt_dist);
+  if (!connec_dist.empty()) record_distribution(e,"ElementConnectivity",connec_dist);
+}
+
+/// PointList (and PointListDonor) are of shape (1,N): the blocks are along N
+auto
+load_point_list_blocks(tree& t, std::vector<std::string>& path, const block_reader& br) -> void {
+  tree& pl = get_child_by_name(t,"PointList");
+  const node_value& pl_val = value(std::as_const(pl));
+  if (pl_val.rank()!=2 || pl_val.extent(0)!=1) return;
+  std::vector<I8> dist = distribution(t,"Index",uniform_distribution(pl_val.extent(1),br.i_rank,br.n_rank));
+
+  path.push_back(name(t).str());
+  for (std::string pl_name : {"PointList","PointListDonor"}) {
+    if (!has_child_of_name(t,pl_name)) continue;
+    tree& c = get_child_by_name(t,pl_name);
+    if (value(std::as_const(c)).extent(1)!=dist[2]) {
+      throw cgns_exception("load_distributed_tree: \""+pl_name+"\" of node \""+name(t).str()+"\" is not of the size of its distribution");
+    }
+    path.push_back(pl_name);
+    set_value(c,read_block(br,data_path(br.file,path),value(std::as_const(c)).type_id(),dist[0],dist[1]));
+    path.pop_back();
+  }
+  path.pop_back();
+
+  record_distribution(t,"Index",dist);
+}
+
+auto load_blocks(tree& t, std::vector<std::string>& path, const block_reader& br) -> void;
+
+auto
+load_zone_blocks(tree& z, std::vector<std::string>& path, const block_reader& br) -> void {
+  // zone value: (index dimension,3), with columns [vertex sizes, cell sizes, boundary vertex sizes]
+  std::vector<I8> zone_dims = integer_values(value(std::as_const(z)));
+  I8 index_dim = value(std::as_const(z)).extent(0);
+  I8 n_vtx = 1;
+  I8 n_cell = 1;
+  for (I8 k=0; k<index_dim; ++k) {
+    n_vtx  *= zone_dims[k];
+    n_cell *= zone_dims[index_dim+k];
+  }
+  std::vector<I8> vtx_dist  = distribution(z,"Vertex",uniform_distribution(n_vtx ,br.i_rank,br.n_rank));
+  std::vector<I8> cell_dist = distribution(z,"Cell"  ,uniform_distribution(n_cell,br.i_rank,br.n_rank));
+  // structured zones: the arrays are multi-dimensional, hence loaded whole, and the zone gets no distribution
+  bool vtx_loaded = false;
+  bool cell_loaded = false;
+
+  path.push_back(name(z).str());
+  for (tree& c : children(z)) {
+    if (label(c)=="GridCoordinates_t") {
+      vtx_loaded = load_data_array_blocks(c,path,vtx_dist,br) || vtx_loaded;
+    } else if (label(c)=="FlowSolution_t") {
+      std::string loc = has_child_of_name(c,"GridLocation") ? GridLocation(c) : "Vertex";
+      if (loc=="Vertex") vtx_loaded = load_data_array_blocks(c,path,vtx_dist,br) || vtx_loaded;
+      else if (loc=="CellCenter") cell_loaded = load_data_array_blocks(c,path,cell_dist,br) || cell_loaded;
+    } else if (label(c)=="Elements_t") {
+      load_element_blocks(c,path,br);
+    } else if (name(c)!=distribution_name) {
+      load_blocks(c,path,br);
+    }
+  }
+  path.pop_back();
+
+  // after the loop: adding a child would invalidate the iteration over the children
+  if (vtx_loaded) record_distribution(z,"Vertex",vtx_dist);
+  if (cell_loaded) record_distribution(z,"Cell",cell_dist);
+}
+
+auto
+load_blocks(tree& t, std::vector<std::string>& path, const block_reader& br) -> void {
+  if (label(t)=="Zone_t") return load_zone_blocks(t,path,br);
+  if (has_child_of_name(t,"PointList")) load_point_list_blocks(t,path,br);
+
+  path.push_back(name(t).str());
+  for (tree& c : children(t)) {
+    if (name(c)!=distribution_name) load_blocks(c,path,br);
+  }
+  path.pop_back();
+}
+
+auto
+load_distributed_tree(const std::string& file_name, const block_reader& br) -> tree {
+  // the tree is loaded by each process independently (small arrays), except its big arrays,
+  // that are either loaded by block, or only when accessed
+  auto skeleton_file = std::make_shared<const hdf5_handle>(H5Fopen(file_name.c_str(),H5F_ACC_RDONLY,H5P_DEFAULT),H5Fclose,"unable to open file \""+file_name+"\"");
+  load_options opts;
+  opts.skeleton = true;
+  tree t = load_tree(std::move(skeleton_file),file_name,opts);
+
+  std::vector<std::string> path;
+  for (tree& c : children(t)) {
+    load_blocks(c,path,br);
+  }
+  return t;
+}
+
+} // anonymous
+
+
+auto
+load_distributed_tree(const std::string& file_name, int i_rank, int n_rank) -> tree {
+  if (n_rank<1 || i_rank<0 || i_rank>=n_rank) {
+    throw cgns_exception("load_distributed_tree: invalid rank "+std::to_string(i_rank)+" among "+std::to_string(n_rank));
+  }
+  hdf5_lock lock;
+  hdf5_handle file(H5Fopen(file_name.c_str(),H5F_ACC_RDONLY,H5P_DEFAULT),H5Fclose,"unable to open file \""+file_name+"\"");
+  return load_distributed_tree(file_name,block_reader{file,H5P_DEFAULT,i_rank,n_rank});
+}
+
+#ifdef H5_HAVE_PARALLEL
+auto
+load_distributed_tree(const std::string& file_name, MPI_Comm comm) -> tree {
+  int i_rank, n_rank;
+  MPI_Comm_rank(comm,&i_rank);
+  MPI_Comm_size(comm,&n_rank);
+
+  hdf5_lock lock;
+
+  hdf5_handle fapl(H5Pcreate(H5P_FILE_ACCESS),H5Pclose,"unable to create file access properties");
+  check(H5Pset_fapl_mpio(fapl,comm,MPI_INFO_NULL),"unable to set MPI-IO file access");
+  hdf5_handle dxpl(H5Pcreate(H5P_DATASET_XFER),H5Pclose,"unable to create transfer properties");
+  check(H5Pset_dxpl_mpio(dxpl,H5FD_MPIO_COLLECTIVE),"unable to set collective transfer");
+
+  // the MPI-IO file is only used for the blocks: closing it is collective,
+  // so it must not be kept by the arrays that are loaded lazily
+  hdf5_handle file(H5Fopen(file_name.c_str(),H5F_ACC_RDONLY,fapl),H5Fclose,"unable to open file \""+file_name+"\"");
+  return load_distributed_tree(file_name,block_reader{file,dxpl,i_rank,n_rank});
+}
+#endif
+
+
+} // cgns
+#endif // C++>17
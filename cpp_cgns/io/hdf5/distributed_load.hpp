@@ -0,0 +1,40 @@
+#pragma once
+
+
+#include <string>
+#include <vector>
+#include <hdf5.h> // H5_HAVE_PARALLEL, and mpi.h if it is defined
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// Distributed loading of CGNS/HDF5 files
+// Each process loads the whole tree structure, but only its block of the big arrays
+// The block of a process is given by a ":CGNS#Distribution" node (UserDefinedData_t), whose children are
+// DataArray_t [start,end,total]: the process has the entities [start,end) among `total` (0-based)
+//   - Zone_t: "Vertex" and "Cell" distributions
+//       - the DataArray_t of GridCoordinates_t and FlowSolution_t are loaded by block, for Vertex and CellCenter locations
+//   - Elements_t: "Element" distribution, and "ElementConnectivity" distribution for elements with an ElementStartOffset
+//       - ElementConnectivity (and ElementStartOffset) are loaded by block
+//   - nodes with a PointList (BC_t, GridConnectivity_t, ZoneSubRegion_t...): "Index" distribution
+//       - PointList (and PointListDonor) are loaded by block
+// The distribution nodes of the file are used if they are present, else uniform distributions are computed and added
+// Only one-dimensional arrays are distributed: the multi-dimensional arrays of structured zones are loaded as a whole
+
+/// distribution [start,end,total] of process `i_rank` among `n_rank` when `n_total` entities are distributed uniformly
+/// (the first `n_total%n_rank` processes have one more entity)
+auto uniform_distribution(I8 n_total, int i_rank, int n_rank) -> std::vector<I8>;
+
+// [Sphinx Doc] distributed loading {
+/// sequential mode: each process opens the file independently
+auto load_distributed_tree(const std::string& file_name, int i_rank, int n_rank) -> tree;
+#ifdef H5_HAVE_PARALLEL
+/// the file is opened with MPI-IO, and the blocks are read collectively by all the processes of `comm`
+auto load_distributed_tree(const std::string& file_name, MPI_Comm comm) -> tree;
+#endif
+// [Sphinx Doc] distributed loading }
+
+
+} // cgns
@@ -0,0 +1,180 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/io/hdf5/hdf5_utils.hpp"
+
+
+#include <cstring>
+
+
+namespace cgns::hdf5 {
+
+
+// thread safety {
+#ifndef H5_HAVE_THREADSAFE
+auto hdf5_lock::
+mutex() -> std::recursive_mutex& {
+  static std::recursive_mutex m;
+  return m;
+}
+#endif
+// thread safety }
+
+
+// data types {
+auto
+native_type(data_type_id type) -> hid_t {
+  switch (type) {
+    case data_type_id::C1: return H5T_NATIVE_CHAR;
+    case data_type_id::I4: return H5T_NATIVE_INT32;
+    case data_type_id::I8: return H5T_NATIVE_INT64;
+    case data_type_id::R4: return H5T_NATIVE_FLOAT;
+    case data_type_id::R8: return H5T_NATIVE_DOUBLE;
+    case data_type_id::MT: break;
+  }
+  throw cgns_exception("HDF5: no native type for data type "+to_string(type));
+}
+auto
+file_type(data_type_id type) -> hid_t {
+  switch (type) {
+    case data_type_id::C1: return H5T_STD_I8LE;
+    case data_type_id::I4: return H5T_STD_I32LE;
+    case data_type_id::I8: return H5T_STD_I64LE;
+    case data_type_id::R4: return H5T_IEEE_F32LE;
+    case data_type_id::R8: return H5T_IEEE_F64LE;
+    case data_type_id::MT: break;
+  }
+  throw cgns_exception("HDF5: no file type for data type "+to_string(type));
+}
+// data types }
+
+
+// attributes {
+auto
+has_attribute(hid_t obj, const char* attr_name) -> bool {
+  htri_t res = H5Aexists(obj,attr_name);
+  check(res,std::string("unable to query attribute \"")+attr_name+"\"");
+  return res>0;
+}
+
+auto
+read_string_attribute(hid_t obj, const char* attr_name) -> std::string {
+  hdf5_handle attr(H5Aopen(obj,attr_name,H5P_DEFAULT),H5Aclose,std::string("unable to open attribute \"")+attr_name+"\"");
+  hdf5_handle type(H5Aget_type(attr),H5Tclose,"unable to get attribute type");
+  size_t size = H5Tget_size(type);
+
+  hdf5_handle mem_type(H5Tcopy(H5T_C_S1),H5Tclose,"unable to create string type");
+  check(H5Tset_size(mem_type,size),"unable to set string size");
+  std::string res(size,'\0');
+  check(H5Aread(attr,mem_type,res.data()),std::string("unable to read attribute \"")+attr_name+"\"");
+  res.resize(strnlen(res.c_str(),size));
+  return res;
+}
+
+auto
+write_string_attribute(hid_t obj, const char* attr_name, const std::string& value, size_t size) -> void {
+  if (value.size()>=size) {
+    throw cgns_exception(std::string("HDF5: value of attribute \"")+attr_name+"\" is too long: \""+value+"\"");
+  }
+  hdf5_handle type(H5Tcopy(H5T_C_S1),H5Tclose,"unable to create string type");
+  check(H5Tset_size(type,size),"unable to set string size");
+  hdf5_handle space(H5Screate(H5S_SCALAR),H5Sclose,"unable to create dataspace");
+  hdf5_handle attr(H5Acreate2(obj,attr_name,type,space,H5P_DEFAULT,H5P_DEFAULT),H5Aclose,std::string("unable to create attribute \"")+attr_name+"\"");
+
+  std::string buf = value;
+  buf.resize(size,'\0');
+  check(H5Awrite(attr,type,buf.data()),std::string("unable to write attribute \"")+attr_name+"\"");
+}
+// attributes }
+
+
+// string datasets {
+auto
+has_link(hid_t group, const char* link_name) -> bool {
+  htri_t res = H5Lexists(group,link_name,H5P_DEFAULT);
+  check(res,std::string("unable to query link \"")+link_name+"\"");
+  return res>0;
+}
+
+auto
+read_string_dataset(hid_t group, const char* dataset_name) -> std::string {
+  hdf5_handle ds(H5Dopen2(group,dataset_name,H5P_DEFAULT),H5Dclose,std::string("unable to open dataset \"")+dataset_name+"\"");
+  hdf5_handle space(H5Dget_space(ds),H5Sclose,"unable to get dataspace");
+  hssize_t n = H5Sget_simple_extent_npoints(space);
+  std::string res(n,'\0');
+  check(H5Dread(ds,H5T_NATIVE_CHAR,H5S_ALL,H5S_ALL,H5P_DEFAULT,res.data()),std::string("unable to read dataset \"")+dataset_name+"\"");
+  res.resize(strnlen(res.c_str(),n));
+  return res;
+}
+
+auto
+write_string_dataset(hid_t group, const char* dataset_name, const std::string& value) -> void {
+  hsize_t n = value.size()+1; // the CGNS library writes the null character
+  hdf5_handle space(H5Screate_simple(1,&n,nullptr),H5Sclose,"unable to create dataspace");
+  hdf5_handle ds(
+    H5Dcreate2(group,dataset_name,file_type(data_type_id::C1),space,H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT),
+    H5Dclose,std::string("unable to create dataset \"")+dataset_name+"\""
+  );
+  check(H5Dwrite(ds,H5T_NATIVE_CHAR,H5S_ALL,H5S_ALL,H5P_DEFAULT,value.c_str()),std::string("unable to write dataset \"")+dataset_name+"\"");
+}
+// string datasets }
+
+
+// groups {
+auto
+group_creation_properties() -> hdf5_handle {
+  hdf5_handle gcpl(H5Pcreate(H5P_GROUP_CREATE),H5Pclose,"unable to create group properties");
+  check(H5Pset_link_creation_order(gcpl,H5P_CRT_ORDER_TRACKED|H5P_CRT_ORDER_INDEXED),"unable to set link creation order");
+  return gcpl;
+}
+
+auto
+link_names(hid_t group) -> std::vector<std::string> {
+  hdf5_handle gcpl(H5Gget_create_plist(group),H5Pclose,"unable to get group properties");
+  unsigned order_flags = 0;
+  check(H5Pget_link_creation_order(gcpl,&order_flags),"unable to get link creation order");
+  H5_index_t index = (order_flags & H5P_CRT_ORDER_TRACKED) ? H5_INDEX_CRT_ORDER : H5_INDEX_NAME;
+
+  H5G_info_t info;
+  check(H5Gget_info(group,&info),"unable to get group info");
+  std::vector<std::string> res(info.nlinks);
+  for (hsize_t i=0; i<info.nlinks; ++i) {
+    ssize_t size = H5Lget_name_by_idx(group,".",index,H5_ITER_INC,i,nullptr,0,H5P_DEFAULT);
+    check(size,"unable to get link name");
+    res[i].resize(size+1);
+    check(H5Lget_name_by_idx(group,".",index,H5_ITER_INC,i,res[i].data(),size+1,H5P_DEFAULT),"unable to get link name");
+    res[i].resize(size);
+  }
+  return res;
+}
+
+auto
+dataset_dims(hid_t dataset) -> std::vector<I8> {
+  hdf5_handle space(H5Dget_space(dataset),H5Sclose,"unable to get dataspace");
+  int rank = H5Sget_simple_extent_ndims(space);
+  check(rank,"unable to get dataspace rank");
+  std::vector<hsize_t> h5_dims(rank);
+  check(H5Sget_simple_extent_dims(space,h5_dims.data(),nullptr),"unable to get dataspace dimensions");
+  if (rank==0) return {1};
+  return std::vector<I8>(h5_dims.rbegin(),h5_dims.rend()); // HDF5 is C-ordered, CGNS is Fortran-ordered
+}
+
+auto
+read_dataset(hid_t file, const std::string& dataset_path, data_type_id type, void* out) -> void {
+  hdf5_lock lock;
+  hdf5_handle ds(H5Dopen2(file,dataset_path.c_str(),H5P_DEFAULT),H5Dclose,"unable to open dataset \""+dataset_path+"\"");
+  check(H5Dread(ds,native_type(type),H5S_ALL,H5S_ALL,H5P_DEFAULT,out),"unable to read dataset \""+dataset_path+"\"");
+}
+
+auto
+object_path(hid_t obj) -> std::string {
+  ssize_t size = H5Iget_name(obj,nullptr,0);
+  check(size,"unable to get object path");
+  std::string res(size+1,'\0');
+  check(H5Iget_name(obj,res.data(),size+1),"unable to get object path");
+  res.resize(size);
+  return res;
+}
+// groups }
+
+
+} // cgns::hdf5
+#endif // C++>17
@@ -0,0 +1,132 @@
+#pragma once
+
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <hdf5.h>
+#include "cpp_cgns/base/data_type.hpp"
+
+
+namespace cgns::hdf5 {
+
+
+// thread safety {
+#ifdef H5_HAVE_THREADSAFE
+/// HDF5 is built thread-safe: it serializes its calls itself
+class hdf5_lock {
+  public:
+    hdf5_lock() {}
+};
+#else
+/// HDF5 is not thread-safe: calling it from several threads at once is undefined behavior
+/// Hence the cpp_cgns functions calling HDF5 hold this global lock
+/// (and so must the user code calling HDF5 while cpp_cgns may be used by other threads, e.g. by an `async_writer`)
+/// It is recursive, since these functions may call each other
+class hdf5_lock {
+  public:
+    hdf5_lock()
+      : lock(mutex())
+    {}
+  private:
+    static auto mutex() -> std::recursive_mutex&;
+    std::lock_guard<std::recursive_mutex> lock;
+};
+#endif
+// thread safety }
+
+
+// hdf5_handle {
+/// owns an HDF5 identifier, and closes it with the right H5*close function
+class hdf5_handle {
+  public:
+    using close_function = herr_t(*)(hid_t);
+
+    hdf5_handle() = default;
+    /// throws if `id` is invalid (i.e. the call that returned it failed)
+    hdf5_handle(hid_t id, close_function close, const std::string& error_msg)
+      : id(id)
+      , close(close)
+    {
+      if (id<0) throw cgns_exception("HDF5: "+error_msg);
+    }
+
+    hdf5_handle(hdf5_handle&& x)
+      : id(std::exchange(x.id,H5I_INVALID_HID))
+      , close(x.close)
+    {}
+    hdf5_handle& operator=(hdf5_handle&& x) {
+      std::swap(id,x.id);
+      std::swap(close,x.close);
+      return *this;
+    }
+    hdf5_handle(const hdf5_handle&) = delete;
+    hdf5_handle& operator=(const hdf5_handle&) = delete;
+
+    ~hdf5_handle() {
+      if (id>=0 && close) {
+        hdf5_lock lock; // the last owner of a shared handle may be any thread
+        close(id);
+      }
+    }
+
+    operator hid_t() const {
+      return id;
+    }
+  private:
+    hid_t id = H5I_INVALID_HID;
+    close_function close = nullptr;
+};
+
+inline auto
+check(herr_t err, const std::string& error_msg) -> void {
+  if (err<0) throw cgns_exception("HDF5: "+error_msg);
+}
+// hdf5_handle }
+
+
+// data types {
+/// type of the values in memory
+auto native_type(data_type_id type) -> hid_t;
+/// type of the values in a file (little-endian, as written by the CGNS library)
+auto file_type(data_type_id type) -> hid_t;
+// data types }
+
+
+// CGNS/HDF5 node layout {
+/// names of the special children of a CGNS/HDF5 node group (they begin by a space, so they can't clash with CGNS names)
+inline constexpr const char* data_dataset_name = " data";
+inline constexpr const char* link_file_dataset_name = " file";
+inline constexpr const char* link_path_dataset_name = " path";
+inline constexpr const char* link_name = " link";
+
+/// sizes of the fixed-length attributes, null character included
+inline constexpr size_t name_attribute_size = 33;
+inline constexpr size_t label_attribute_size = 33;
+inline constexpr size_t type_attribute_size = 3;
+
+auto has_attribute(hid_t obj, const char* attr_name) -> bool;
+auto read_string_attribute(hid_t obj, const char* attr_name) -> std::string;
+auto write_string_attribute(hid_t obj, const char* attr_name, const std::string& value, size_t size) -> void;
+
+auto has_link(hid_t group, const char* link_name) -> bool;
+/// C1 dataset, as written for link paths
+auto read_string_dataset(hid_t group, const char* dataset_name) -> std::string;
+auto write_string_dataset(hid_t group, const char* dataset_name, const std::string& value) -> void;
+
+/// groups keep the creation order of their children, like the CGNS library does
+auto group_creation_properties() -> hdf5_handle;
+/// names of the links of `group`, in creation order if it was tracked, else in alphabetical order
+auto link_names(hid_t group) -> std::vector<std::string>;
+
+/// dimensions of a dataset, in CGNS (i.e. Fortran) order
+auto dataset_dims(hid_t dataset) -> std::vector<I8>;
+/// reads the whole dataset at `dataset_path` of `file` into `out`
+auto read_dataset(hid_t file, const std::string& dataset_path, data_type_id type, void* out) -> void;
+/// path of an HDF5 object in its file
+auto object_path(hid_t obj) -> std::string;
+// CGNS/HDF5 node layout }
+
+
+} // cgns::hdf5
@@ -0,0 +1,87 @@
+#pragma once
+
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "cpp_cgns/io/hdf5/hdf5_utils.hpp"
+
+
+namespace cgns::hdf5 {
+
+
+/// range whose data is read from an HDF5 dataset the first time it is accessed
+/// the file stays open as long as a lazy array refers to it
+template<Data_type T>
+class lazy_dataset_array {
+  public:
+    using value_type = T;
+
+    lazy_dataset_array(std::shared_ptr<const hdf5_handle> file, std::string dataset_path, size_t n)
+      : state(std::make_unique<lazy_state>(std::move(file),std::move(dataset_path),n))
+    {}
+
+    auto
+    size() const -> size_t {
+      return state->n;
+    }
+    auto
+    data() -> T* {
+      return loaded();
+    }
+    auto
+    data() const -> const T* {
+      return loaded();
+    }
+
+    auto begin()       ->       T* { return data(); }
+    auto begin() const -> const T* { return data(); }
+    auto end()         ->       T* { return data()+size(); }
+    auto end()   const -> const T* { return data()+size(); }
+
+    auto operator[](I8 i)       ->       T& { return data()[i]; }
+    auto operator[](I8 i) const -> const T& { return data()[i]; }
+
+    auto
+    is_loaded() const -> bool {
+      return state->is_loaded;
+    }
+  private:
+    struct lazy_state {
+      lazy_state(std::shared_ptr<const hdf5_handle> file, std::string dataset_path, size_t n)
+        : file(std::move(file))
+        , dataset_path(std::move(dataset_path))
+        , n(n)
+      {}
+
+      std::shared_ptr<const hdf5_handle> file;
+      std::string dataset_path;
+      size_t n;
+      std::once_flag loaded_flag;
+      std::atomic<bool> is_loaded = false;
+      std::vector<T> cache;
+    };
+
+    auto
+    loaded() const -> T* {
+      if (!state->is_loaded) {
+        // any thread may access the data first: HDF5 calls must be serialized
+        // the lock is taken before the once_flag, because a thread already holding it (e.g. in `save_tree`) may also load the array
+        hdf5_lock lock;
+        std::call_once(state->loaded_flag,[this](){
+          state->cache.resize(state->n);
+          read_dataset(*state->file,state->dataset_path,type_id_of<T>,state->cache.data());
+          state->is_loaded = true;
+          state->file.reset(); // the file is not needed anymore
+        });
+      }
+      return state->cache.data();
+    }
+
+    std::unique_ptr<lazy_state> state; // unique_ptr: once_flag is not movable
+};
+
+
+} // cgns::hdf5
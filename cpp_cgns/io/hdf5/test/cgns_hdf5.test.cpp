@@ -0,0 +1,117 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/io/hdf5/cgns_hdf5.hpp"
+#include "cpp_cgns/tree_manip.hpp"
+#include <cstdio>
+
+using namespace cgns;
+
+TEST_CASE("CGNS/HDF5 load and save") {
+  std::string file_name = "cgns_hdf5_test.hdf";
+  tree t = {"CGNSTree", "CGNSTree_t", MT(), {
+    tree{"CGNSLibraryVersion", "CGNSLibraryVersion_t", node_value(R4(4.2f))},
+    tree{"Base", "CGNSBase_t", node_value({3,3}), {
+      tree{"Zone", "Zone_t", node_value({{9,4,0}}), {
+        tree{"ZoneType", "ZoneType_t", node_value("Unstructured")},
+        tree{"GridCoordinates", "GridCoordinates_t", MT(), {
+          tree{"CoordinateX", "DataArray_t", node_value(std::vector<R8>{0.,1.,2.,0.,1.,2.,0.,1.,2.})} } },
+        tree{"Connectivity", "Elements_t", node_value({7,0}), {
+          tree{"ElementConnectivity", "DataArray_t", node_value(std::vector<I8>{1,2,5,4, 2,3,6,5})} } } } } } }
+  };
+
+  SUBCASE("round trip") {
+    // [Sphinx Doc] CGNS/HDF5 example {
+    save_tree(t,file_name);
+    tree t2 = load_tree(file_name);
+    // [Sphinx Doc] CGNS/HDF5 example }
+    CHECK( t2 == t );
+    CHECK( name(child(t2,1)) == "Base" ); // children order is preserved
+    CHECK( value(get_node_by_matching(t2,"Base/Zone")).rank() == 2 );
+  }
+
+  SUBCASE("links") {
+    std::string linked_file_name = "cgns_hdf5_test_linked.hdf";
+    save_tree(t,linked_file_name);
+
+    std::vector<link_spec> links = {
+      {"Base/Zone/GridCoordinates", "cgns_hdf5_test_linked.hdf", "/Base/Zone/GridCoordinates"},
+      {"Base/Zone/ZoneType", "", "/Base/Zone/Connectivity/ElementConnectivity"}
+    };
+    save_tree(t,file_name,links);
+    tree t2 = load_tree(file_name);
+
+    const tree& z = get_node_by_matching(t2,"Base/Zone");
+    CHECK( get_child_by_name(z,"GridCoordinates") == get_node_by_matching(t,"Base/Zone/GridCoordinates") );
+    const tree& zone_type = get_child_by_name(z,"ZoneType"); // link in the same file: renamed copy of the target
+    CHECK( label(zone_type) == "DataArray_t" );
+    CHECK( value(zone_type) == std::vector<I8>{1,2,5,4, 2,3,6,5} );
+
+    std::remove(linked_file_name.c_str());
+  }
+
+  SUBCASE("broken links") {
+    std::vector<link_spec> links = {
+      {"Base/Zone/GridCoordinates", "cgns_hdf5_test_missing.hdf", "/Base/Zone/GridCoordinates"}
+    };
+    save_tree(t,file_name,links);
+
+    CHECK_THROWS_AS( load_tree(file_name), const cgns_exception& );
+
+    SUBCASE("excluded") {
+      load_options opts;
+      opts.exclude = {"Base/Zone/GridCoordinates"};
+      tree t2 = load_tree(file_name,opts); // the link is not followed
+      CHECK_FALSE( has_node(t2,"Base/Zone/GridCoordinates") );
+      CHECK( has_node(t2,"Base/Zone/Connectivity/ElementConnectivity") );
+    }
+    SUBCASE("not included") {
+      load_options opts;
+      opts.include = {"Base/Zone/Elements_t"};
+      tree t2 = load_tree(file_name,opts);
+      CHECK_FALSE( has_node(t2,"Base/Zone/GridCoordinates") );
+      CHECK( has_node(t2,"Base/Zone/Connectivity/ElementConnectivity") );
+    }
+  }
+
+  SUBCASE("partial loading") {
+    save_tree(t,file_name);
+
+    SUBCASE("include") {
+      load_options opts;
+      opts.include = {"Base/Zone_t/GridCoordinates"};
+      tree t2 = load_tree(file_name,opts);
+      CHECK( number_of_children(t2) == 1 ); // no CGNSLibraryVersion
+      const tree& z = get_node_by_matching(t2,"Base/Zone");
+      CHECK( number_of_children(z) == 1 );
+      CHECK( number_of_children(get_child_by_name(z,"GridCoordinates")) == 1 ); // the sub-tree is loaded
+    }
+    SUBCASE("exclude") {
+      load_options opts;
+      opts.exclude = {"Base/Zone/Elements_t"};
+      tree t2 = load_tree(file_name,opts);
+      CHECK_FALSE( has_node(t2,"Base/Zone/Connectivity") );
+      CHECK( has_node(t2,"Base/Zone/GridCoordinates/CoordinateX") );
+    }
+    SUBCASE("skeleton") {
+      // [Sphinx Doc] skeleton loading {
+      load_options opts;
+      opts.skeleton = true;
+      opts.skeleton_threshold = 4;
+      tree t2 = load_tree(file_name,opts);
+
+      // the arrays bigger than the threshold are only read when accessed
+      const node_value& x = value(get_node_by_matching(t2,"Base/Zone/GridCoordinates/CoordinateX"));
+      CHECK( x.size() == 9 ); // no read
+      CHECK( data_as<R8>(x)[8] == 2. ); // read
+      // [Sphinx Doc] skeleton loading }
+      CHECK( t2 == t );
+    }
+  }
+
+  SUBCASE("errors") {
+    CHECK_THROWS_AS( load_tree("no_such_file.hdf") , const cgns_exception& );
+  }
+
+  std::remove(file_name.c_str());
+}
+#endif // C++>17
@@ -0,0 +1,102 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/io/hdf5/distributed_load.hpp"
+#include "cpp_cgns/io/hdf5/cgns_hdf5.hpp"
+#include "cpp_cgns/tree_manip.hpp"
+#include "cpp_cgns/sids/creation.hpp"
+#include <cstdio>
+
+using namespace cgns;
+
+TEST_CASE("uniform_distribution") {
+  CHECK( uniform_distribution(9,0,2) == std::vector<I8>{0,5,9} );
+  CHECK( uniform_distribution(9,1,2) == std::vector<I8>{5,9,9} );
+  CHECK( uniform_distribution(1,2,3) == std::vector<I8>{1,1,1} );
+}
+
+TEST_CASE("distributed loading") {
+  std::string file_name = "distributed_load_test.hdf";
+  tree t = {"CGNSTree", "CGNSTree_t", MT(), {
+    tree{"Base", "CGNSBase_t", node_value({2,2}), {
+      tree{"Zone", "Zone_t", node_value({{9,4,0}}), {
+        tree{"ZoneType", "ZoneType_t", node_value("Unstructured")},
+        tree{"GridCoordinates", "GridCoordinates_t", MT(), {
+          tree{"CoordinateX", "DataArray_t", node_value(std::vector<R8>{0.,1.,2.,0.,1.,2.,0.,1.,2.})} } },
+        tree{"FlowSolution", "FlowSolution_t", MT(), {
+          tree{"GridLocation", "GridLocation_t", node_value("CellCenter")},
+          tree{"Density", "DataArray_t", node_value(std::vector<R8>{1.,2.,3.,4.})} } },
+        tree{"Quads", "Elements_t", node_value({7,0}), {
+          tree{"ElementRange", "IndexRange_t", node_value({1,4})},
+          tree{"ElementConnectivity", "DataArray_t", node_value(std::vector<I4>{1,2,5,4, 2,3,6,5, 4,5,8,7, 5,6,9,8})} } },
+        tree{"Faces", "Elements_t", node_value({22,0}), {
+          tree{"ElementRange", "IndexRange_t", node_value({5,7})},
+          tree{"ElementStartOffset", "DataArray_t", node_value(std::vector<I4>{0,2,5,9})},
+          tree{"ElementConnectivity", "DataArray_t", node_value(std::vector<I4>{1,2, 3,4,5, 6,7,8,9})} } },
+        tree{"ZoneBC", "ZoneBC_t", MT(), {
+          tree{"Wall", "BC_t", node_value("BCWall"), {
+            tree{"PointList", "IndexArray_t", node_value({{1,2,3,4,5}})} } } } } } } } }
+  };
+  save_tree(t,file_name);
+
+  SUBCASE("uniform distributions") {
+    // [Sphinx Doc] distributed loading example {
+    tree t1 = load_distributed_tree(file_name,1,2); // process 1 among 2
+    // [Sphinx Doc] distributed loading example }
+    const tree& z = get_node_by_matching(t1,"Base/Zone");
+
+    CHECK( value(get_node_by_matching(z,":CGNS#Distribution/Vertex")) == std::vector<I8>{5,9,9} );
+    CHECK( value(get_node_by_matching(z,"GridCoordinates/CoordinateX")) == std::vector<R8>{1.,2.,0.,1.,2.} );
+    CHECK( value(get_node_by_matching(z,":CGNS#Distribution/Cell")) == std::vector<I8>{2,4,4} );
+    CHECK( value(get_node_by_matching(z,"FlowSolution/Density")) == std::vector<R8>{3.,4.} );
+
+    CHECK( value(get_node_by_matching(z,"Quads/:CGNS#Distribution/Element")) == std::vector<I8>{2,4,4} );
+    CHECK( value(get_node_by_matching(z,"Quads/ElementConnectivity")) == std::vector<I4>{4,5,8,7, 5,6,9,8} );
+
+    CHECK( value(get_node_by_matching(z,"Faces/:CGNS#Distribution/Element")) == std::vector<I8>{2,3,3} );
+    CHECK( value(get_node_by_matching(z,"Faces/:CGNS#Distribution/ElementConnectivity")) == std::vector<I8>{5,9,9} );
+    CHECK( value(get_node_by_matching(z,"Faces/ElementStartOffset")) == std::vector<I4>{5,9} );
+    CHECK( value(get_node_by_matching(z,"Faces/ElementConnectivity")) == std::vector<I4>{6,7,8,9} );
+
+    CHECK( value(get_node_by_matching(z,"ZoneBC/Wall/:CGNS#Distribution/Index")) == std::vector<I8>{3,5,5} );
+    const node_value& pl = value(get_node_by_matching(z,"ZoneBC/Wall/PointList"));
+    REQUIRE( pl.extent() == std::vector<I8>{1,2} );
+    CHECK( data_as<I4>(pl)[0] == 4 );
+    CHECK( data_as<I4>(pl)[1] == 5 );
+  }
+
+  SUBCASE("distributions of the file") {
+    emplace_child(get_node_by_matching(t,"Base/Zone"),new_Distribution("Vertex",std::vector<I8>{0,3,9}));
+    save_tree(t,file_name);
+
+    tree t0 = load_distributed_tree(file_name,0,2);
+    CHECK( value(get_node_by_matching(t0,"Base/Zone/GridCoordinates/CoordinateX")) == std::vector<R8>{0.,1.,2.} );
+    CHECK( value(get_node_by_matching(t0,"Base/Zone/FlowSolution/Density")) == std::vector<R8>{1.,2.} ); // uniform
+  }
+
+  SUBCASE("structured zones are loaded whole") {
+    tree t_structured = {"CGNSTree", "CGNSTree_t", MT(), {
+      tree{"Base", "CGNSBase_t", node_value({2,2}), {
+        tree{"Zone", "Zone_t", node_value({{3,2,0},{3,2,0}}), {
+          tree{"ZoneType", "ZoneType_t", node_value("Structured")},
+          tree{"GridCoordinates", "GridCoordinates_t", MT(), {
+            tree{"CoordinateX", "DataArray_t", node_value({{0.,1.,2.},{0.,1.,2.},{0.,1.,2.}})} } } } } } } }
+    };
+    save_tree(t_structured,file_name);
+
+    tree t1 = load_distributed_tree(file_name,1,2);
+    const tree& z = get_node_by_matching(t1,"Base/Zone");
+    CHECK_FALSE( has_child_of_name(z,":CGNS#Distribution") ); // no array loaded by block
+    CHECK( value(get_node_by_matching(z,"GridCoordinates/CoordinateX")).extent() == std::vector<I8>{3,3} );
+  }
+
+  SUBCASE("errors") {
+    CHECK_THROWS_AS( load_distributed_tree(file_name,2,2) , const cgns_exception& );
+
+    emplace_child(get_node_by_matching(t,"Base/Zone"),new_Distribution("Vertex",std::vector<I8>{0,3,8}));
+    save_tree(t,file_name);
+    CHECK_THROWS_AS( load_distributed_tree(file_name,0,2) , const cgns_exception& ); // 9 vertices, not 8
+  }
+
+  std::remove(file_name.c_str());
+}
+#endif // C++>17
@@ -0,0 +1,96 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/io/async_writer.hpp"
+#include "cpp_cgns/tree_manip.hpp"
+#include <map>
+
+using namespace cgns;
+
+namespace {
+  /// "writes" the trees in memory
+  struct memory_files {
+    std::mutex mutex;
+    std::map<std::string,tree> files;
+
+    auto
+    writer() {
+      return [this](const tree& t, const std::string& file_name){
+        std::lock_guard lock(mutex);
+        files[file_name] = clone(t);
+      };
+    }
+  };
+}
+
+TEST_CASE("async_writer") {
+  memory_files mem;
+  tree t = {"Base", "CGNSBase_t", node_value({3,3}), {
+    tree{"Density", "DataArray_t", node_value(std::vector<R8>{1.,2.,3.})} }
+  };
+  tree t_ref = clone(t);
+
+  SUBCASE("the written tree is a snapshot") {
+    // [Sphinx Doc] async_writer example {
+    std::promise<void> solver_iteration_done;
+    std::shared_future<void> can_write = solver_iteration_done.get_future().share();
+    async_writer w(
+      [&](const tree& t, const std::string& file_name){
+        can_write.wait(); // writing only starts after the tree is modified
+        mem.writer()(t,file_name);
+      }
+    );
+
+    std::future<void> written = w.save(t,"checkpoint_0");
+    data_as<R8>(mutable_value(get_child_by_name(t,"Density")))[0] = 10.; // copy-on-write: the snapshot is not modified
+    solver_iteration_done.set_value();
+    written.get();
+    // [Sphinx Doc] async_writer example }
+
+    CHECK( mem.files.at("checkpoint_0") == t_ref );
+    CHECK( value(get_child_by_name(t,"Density")) == std::vector<R8>{10.,2.,3.} );
+  }
+
+  SUBCASE("deep copy") {
+    std::promise<void> solver_iteration_done;
+    std::shared_future<void> can_write = solver_iteration_done.get_future().share();
+    async_writer w(
+      [&](const tree& t, const std::string& file_name){
+        can_write.wait();
+        mem.writer()(t,file_name);
+      },
+      {.deep_copy=true}
+    );
+
+    auto density = view_as_span<R8>(mutable_value(get_child_by_name(t,"Density"))); // obtained before `save`
+    std::future<void> written = w.save(t,"checkpoint_0");
+    density[0] = 10.;
+    solver_iteration_done.set_value();
+    written.get();
+
+    CHECK( mem.files.at("checkpoint_0") == t_ref );
+  }
+
+  SUBCASE("several snapshots and stats") {
+    async_writer w(mem.writer(),{.n_threads=2,.max_pending_bytes=1});
+    for (int i=0; i<5; ++i) {
+      w.save(t,"checkpoint_"+std::to_string(i)); // blocks until the previous snapshot is written
+    }
+    w.wait();
+
+    async_writer_stats s = w.stats();
+    CHECK( mem.files.size() == 5 );
+    CHECK( s.n_written == 5 );
+    CHECK( s.bytes_written == 5*(2*4+3*8) );
+    CHECK( s.queue_depth == 0 );
+    CHECK( s.pending_bytes == 0 );
+  }
+
+  SUBCASE("errors") {
+    async_writer w([](const tree&, const std::string&){ throw cgns_exception("write failed"); });
+    std::future<void> written = w.save(t,"checkpoint");
+    CHECK_THROWS_AS( written.get() , const cgns_exception& );
+    w.wait();
+    CHECK( w.stats().n_written == 0 );
+  }
+}
+#endif // C++>17
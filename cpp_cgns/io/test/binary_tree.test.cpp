@@ -0,0 +1,81 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/io/binary_tree.hpp"
+#include "cpp_cgns/tree_manip.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+using namespace cgns;
+
+TEST_CASE("binary tree files") {
+  std::string file_name = "binary_tree_test.bin";
+  tree t = {"CGNSTree", "CGNSTree_t", MT(), {
+    tree{"Base", "CGNSBase_t", node_value({3,3}), {
+      tree{"Zone", "Zone_t", node_value({{9,4,0}}), {
+        tree{"ZoneType", "ZoneType_t", node_value("Unstructured")},
+        tree{"GridCoordinates", "GridCoordinates_t", MT(), {
+          tree{"CoordinateX", "DataArray_t", node_value(std::vector<R8>{0.,1.,2.,0.,1.,2.,0.,1.,2.})},
+          tree{"CoordinateY", "DataArray_t", node_value(std::vector<R4>{0.f,0.f,0.f,1.f,1.f,1.f,2.f,2.f,2.f})} } },
+        tree{"Empty", "DataArray_t", node_value(std::vector<I8>{})},
+        tree{"UserData", "A_label_that_is_not_a_SIDS_label", node_value(std::vector<I8>{1,2,3})} } } } }
+  };
+
+  SUBCASE("round trip") {
+    // [Sphinx Doc] binary tree example {
+    save_binary_tree(t,file_name);
+    tree t2 = load_binary_tree(file_name); // the node values point into the mapped file
+    // [Sphinx Doc] binary tree example }
+    CHECK( t2 == t );
+    CHECK( value(get_node_by_matching(t2,"Base/Zone")).rank() == 2 );
+
+    const node_value& x = value(get_node_by_matching(t2,"Base/Zone/GridCoordinates/CoordinateX"));
+    CHECK( reinterpret_cast<std::uintptr_t>(data_as<R8>(x)) % 64 == 0 );
+  }
+
+  SUBCASE("copy-on-write mapping") {
+    save_binary_tree(t,file_name);
+    tree t2 = load_binary_tree(file_name);
+    data_as<R8>(mutable_value(get_node_by_matching(t2,"Base/Zone/GridCoordinates/CoordinateX")))[0] = 10.;
+
+    CHECK( load_binary_tree(file_name) == t ); // the file is not modified
+  }
+
+  SUBCASE("saving over a mapped file") {
+    save_binary_tree(t,file_name);
+    tree t2 = load_binary_tree(file_name);
+    save_binary_tree(tree{"Base", "CGNSBase_t", node_value({3,3})},file_name); // the file is replaced, not overwritten
+
+    CHECK( t2 == t ); // the mapping of the previous file is still valid
+    CHECK( children(load_binary_tree(file_name)).size() == 0 );
+  }
+
+  SUBCASE("errors") {
+    CHECK_THROWS_AS( load_binary_tree("no_such_file.bin") , const cgns_exception& );
+
+    std::ofstream f(file_name,std::ios::binary);
+    f << std::string(64,'x'); // not a binary tree file
+    f.close();
+    CHECK_THROWS_AS( load_binary_tree(file_name) , const cgns_exception& );
+
+    save_binary_tree(t,file_name);
+    std::ofstream g(file_name,std::ios::binary|std::ios::in|std::ios::out);
+    g.seekp(16); // number of nodes
+    std::uint64_t n_nodes = 1000;
+    g.write(reinterpret_cast<const char*>(&n_nodes),sizeof(n_nodes));
+    g.close();
+    CHECK_THROWS_AS( load_binary_tree(file_name) , const cgns_exception& );
+
+    tree deep = {"Node", "UserDefinedData_t", MT()};
+    for (int i=0; i<2000; ++i) {
+      tree parent = {"Node", "UserDefinedData_t", MT()};
+      emplace_child(parent,std::move(deep));
+      deep = std::move(parent);
+    }
+    save_binary_tree(deep,file_name);
+    CHECK_THROWS_AS( load_binary_tree(file_name) , const cgns_exception& ); // too deep
+  }
+
+  std::remove(file_name.c_str());
+}
+#endif // C++>17
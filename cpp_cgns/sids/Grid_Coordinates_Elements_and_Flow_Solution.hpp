@@ -17,7 +17,7 @@ namespace cgns {
 template<class Tree> auto
 ElementType_ElementSizeBoundary(Tree& e) -> auto& {
   STD_E_ASSERT(label(e)=="Elements_t");
-  return value(e);
+  return value_of_same_constness(e);
 }
 
 template<class Tree> auto
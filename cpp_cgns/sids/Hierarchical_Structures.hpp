@@ -20,7 +20,7 @@ dims_of_unstruct_zone(Tree& z) {
   if (value(z).rank()!=2 || value(z).extent(0)!=1 || value(z).extent(1)!=3)
     throw cgns_exception("CGNS requires unstructured zone dimensions to be an array of shape {1x3}");
 
-  I* zone_dims_ptr = (I*)value(z).data();
+  I* zone_dims_ptr = (I*)value_of_same_constness(z).data();
   return std_e::make_span<2>(zone_dims_ptr);
 }
 
@@ -9,92 +9,92 @@ namespace cgns {
 
 
 auto
-new_DataArray(const std::string& name, node_value&& value) -> tree {
-  return {name, "DataArray_t", std::move(value)};
+new_DataArray(const std::string& name, node_value&& value, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "DataArray_t", std::move(value)};
 }
 auto
-new_UserDefinedData(const std::string& name, node_value value) -> tree {
-  return {name, "UserDefinedData_t", std::move(value)};
+new_UserDefinedData(const std::string& name, node_value value, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "UserDefinedData_t", std::move(value)};
 }
 auto
-new_UserDefinedData(const std::string& name, const std::string& val) -> tree {
-  return {name, "UserDefinedData_t", node_value(val)};
+new_UserDefinedData(const std::string& name, const std::string& val, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "UserDefinedData_t", node_value(val)};
 }
 
 auto
-new_CGNSVersionNode(R4 version) -> tree {
-  return {"CGNSLibraryVersion", "CGNSLibraryVersion_t", node_value(version)};
+new_CGNSVersionNode(R4 version, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "CGNSLibraryVersion", "CGNSLibraryVersion_t", node_value(version)};
 }
 
 auto
-new_CGNSTree() -> tree {
-  return { "CGNSTree", "CGNSTree_t", MT(), {new_CGNSVersionNode()} };
+new_CGNSTree(const tree::allocator_type& a) -> tree {
+  return { std::allocator_arg, a, "CGNSTree", "CGNSTree_t", MT(), {new_CGNSVersionNode(3.1,a)} };
 }
 
 
 auto
-new_ZoneBC() -> tree {
-  return {"ZoneBC", "ZoneBC_t", MT()};
+new_ZoneBC(const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "ZoneBC", "ZoneBC_t", MT()};
 }
 auto
-new_ZoneGridConnectivity() -> tree {
-  return {"ZoneGridConnectivity", "ZoneGridConnectivity_t", MT()};
+new_ZoneGridConnectivity(const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "ZoneGridConnectivity", "ZoneGridConnectivity_t", MT()};
 }
 
 auto
-new_GridCoordinates(const std::string& name) -> tree {
-  return {name, "GridCoordinates_t", MT()};
+new_GridCoordinates(const std::string& name, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "GridCoordinates_t", MT()};
 }
 
 
 
 
 auto
-new_FlowSolution(const std::string& name, const std::string& gridLoc) -> tree {
-  return {name, "FlowSolution_t", MT(), {new_GridLocation(gridLoc)}};
+new_FlowSolution(const std::string& name, const std::string& gridLoc, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "FlowSolution_t", MT(), {new_GridLocation(gridLoc,a)}};
 }
 auto
-new_DiscreteData(const std::string& name, const std::string& gridLoc) -> tree {
-  return {name, "DiscreteData_t", MT(), {new_GridLocation(gridLoc)}};
+new_DiscreteData(const std::string& name, const std::string& gridLoc, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "DiscreteData_t", MT(), {new_GridLocation(gridLoc,a)}};
 }
 auto
-new_BCDataSet(const std::string& name, const std::string& val, const std::string& gridLoc) -> tree {
-  return {name, "BCDataSet_t", node_value(val), {new_GridLocation(gridLoc)}};
+new_BCDataSet(const std::string& name, const std::string& val, const std::string& gridLoc, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "BCDataSet_t", node_value(val), {new_GridLocation(gridLoc,a)}};
 }
 auto
-new_BCData(const std::string& name) -> tree {
-  return {name, "BCData_t", MT()};
+new_BCData(const std::string& name, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "BCData_t", MT()};
 }
 
 
 auto
-new_GridLocation(const std::string& loc) -> tree {
-  return {"GridLocation","GridLocation_t",node_value(loc)};
+new_GridLocation(const std::string& loc, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "GridLocation","GridLocation_t",node_value(loc)};
 }
 auto
-new_Family(const std::string& name) -> tree {
-  return {name, "Family_t", MT()};
+new_Family(const std::string& name, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "Family_t", MT()};
 }
 auto
-new_FamilyBC(const std::string& famName) -> tree {
-  return {"FamilyBC", "FamilyBC_t", node_value(famName)};
+new_FamilyBC(const std::string& famName, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "FamilyBC", "FamilyBC_t", node_value(famName)};
 }
 
 auto
-new_Descriptor(const std::string& name, const std::string& val) -> tree {
-  return {name, "Descriptor_t", node_value(val)};
+new_Descriptor(const std::string& name, const std::string& val, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "Descriptor_t", node_value(val)};
 }
 
 auto
-new_GridConnectivityType(const std::string& gc_type) -> tree {
-  return {"GridConnectivityType","GridConnectivityType_t",node_value(gc_type)};
+new_GridConnectivityType(const std::string& gc_type, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "GridConnectivityType","GridConnectivityType_t",node_value(gc_type)};
 }
 auto
-new_GridConnectivity(const std::string& name, const std::string& z_donor_name, const std::string& loc, const std::string& connec_type) -> tree {
+new_GridConnectivity(const std::string& name, const std::string& z_donor_name, const std::string& loc, const std::string& connec_type, const tree::allocator_type& a) -> tree {
   return
-    { name, "GridConnectivity_t", node_value(z_donor_name),
-      { new_GridLocation(loc),
-        new_GridConnectivityType(connec_type) } };
+    { std::allocator_arg, a, name, "GridConnectivity_t", node_value(z_donor_name),
+      { new_GridLocation(loc,a),
+        new_GridConnectivityType(connec_type,a) } };
 }
 
 
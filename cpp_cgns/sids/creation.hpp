@@ -13,137 +13,140 @@ namespace cgns {
 // Then the range will be type-erased and stored in a node_value
 // For now, this is only done for std::vector
 
+// The children storage of the created nodes (and of their sub-nodes) is allocated with `a`
+// (e.g. `arena.allocator()` to create them in a tree_arena, see tree_arena.hpp)
+
 // [Sphinx Doc] creation according to SIDS {
-auto new_CGNSTree() -> tree;
-auto new_CGNSVersionNode(R4 version = 3.1) -> tree;
+auto new_CGNSTree(const tree::allocator_type& a = {}) -> tree;
+auto new_CGNSVersionNode(R4 version = 3.1, const tree::allocator_type& a = {}) -> tree;
 
-auto new_GridCoordinates(const std::string& name="GridCoordinates") -> tree;
-auto new_ZoneBC() -> tree;
-auto new_ZoneGridConnectivity() -> tree;
+auto new_GridCoordinates(const std::string& name="GridCoordinates", const tree::allocator_type& a = {}) -> tree;
+auto new_ZoneBC(const tree::allocator_type& a = {}) -> tree;
+auto new_ZoneGridConnectivity(const tree::allocator_type& a = {}) -> tree;
 
-auto new_GridLocation(const std::string& loc) -> tree;
+auto new_GridLocation(const std::string& loc, const tree::allocator_type& a = {}) -> tree;
 
-auto new_Family(const std::string& name) -> tree;
-auto new_FamilyBC(const std::string& famName) -> tree;
-auto new_FlowSolution(const std::string& name, const std::string& gridLoc) -> tree;
-auto new_DiscreteData(const std::string& name, const std::string& gridLoc) -> tree;
-auto new_BCDataSet(const std::string& name, const std::string& val, const std::string& gridLoc) -> tree;
-auto new_BCData(const std::string& name) -> tree;
-auto new_Descriptor(const std::string& name, const std::string& val) -> tree;
+auto new_Family(const std::string& name, const tree::allocator_type& a = {}) -> tree;
+auto new_FamilyBC(const std::string& famName, const tree::allocator_type& a = {}) -> tree;
+auto new_FlowSolution(const std::string& name, const std::string& gridLoc, const tree::allocator_type& a = {}) -> tree;
+auto new_DiscreteData(const std::string& name, const std::string& gridLoc, const tree::allocator_type& a = {}) -> tree;
+auto new_BCDataSet(const std::string& name, const std::string& val, const std::string& gridLoc, const tree::allocator_type& a = {}) -> tree;
+auto new_BCData(const std::string& name, const tree::allocator_type& a = {}) -> tree;
+auto new_Descriptor(const std::string& name, const std::string& val, const tree::allocator_type& a = {}) -> tree;
 
-auto new_GridConnectivityType(const std::string& gc_type) -> tree;
-auto new_GridConnectivity(const std::string& name, const std::string& z_donor_name, const std::string& loc, const std::string& connec_type) -> tree;
+auto new_GridConnectivityType(const std::string& gc_type, const tree::allocator_type& a = {}) -> tree;
+auto new_GridConnectivity(const std::string& name, const std::string& z_donor_name, const std::string& loc, const std::string& connec_type, const tree::allocator_type& a = {}) -> tree;
 
-                            auto new_DataArray(const std::string& name, node_value&& value) -> tree;
-template<class T, int N   > auto new_DataArray(const std::string& name, const T(&arr)[N]) -> tree;
-template<class T          > auto new_DataArray(const std::string& name, std::vector<T>&& v) -> tree;
-template<class T, int rank> auto new_DataArray(const std::string& name, md_array<T,rank>&& arr) -> tree;
-template<class T, int rank> auto new_DataArray(const std::string& name, md_array_view<T,rank>& arr) -> tree;
+                            auto new_DataArray(const std::string& name, node_value&& value, const tree::allocator_type& a = {}) -> tree;
+template<class T, int N   > auto new_DataArray(const std::string& name, const T(&arr)[N], const tree::allocator_type& a = {}) -> tree;
+template<class T          > auto new_DataArray(const std::string& name, std::vector<T>&& v, const tree::allocator_type& a = {}) -> tree;
+template<class T, int rank> auto new_DataArray(const std::string& name, md_array<T,rank>&& arr, const tree::allocator_type& a = {}) -> tree;
+template<class T, int rank> auto new_DataArray(const std::string& name, md_array_view<T,rank>& arr, const tree::allocator_type& a = {}) -> tree;
 
-                  auto new_UserDefinedData(const std::string& name, node_value value = MT()) -> tree;
-                  auto new_UserDefinedData(const std::string& name, const std::string& val) -> tree;
-template<class T> auto new_UserDefinedData(const std::string& name, const T& val) -> tree;
-template<class T> auto new_UserDefinedData(const std::string& name, std::vector<T>&& v) -> tree;
+                  auto new_UserDefinedData(const std::string& name, node_value value = MT(), const tree::allocator_type& a = {}) -> tree;
+                  auto new_UserDefinedData(const std::string& name, const std::string& val, const tree::allocator_type& a = {}) -> tree;
+template<class T> auto new_UserDefinedData(const std::string& name, const T& val, const tree::allocator_type& a = {}) -> tree;
+template<class T> auto new_UserDefinedData(const std::string& name, std::vector<T>&& v, const tree::allocator_type& a = {}) -> tree;
 
-template<class I> auto new_CGNSBase(const std::string& name, I cellDim, I physDim) -> tree;
-template<class I> auto new_UnstructuredZone(const std::string& name, const I(&dims)[3] = {0,0,0}) -> tree;
-template<class I> auto new_ZoneSubRegion(const std::string& name, I dim, const std::string& gridLoc) -> tree;
+template<class I> auto new_CGNSBase(const std::string& name, I cellDim, I physDim, const tree::allocator_type& a = {}) -> tree;
+template<class I> auto new_UnstructuredZone(const std::string& name, const I(&dims)[3] = {0,0,0}, const tree::allocator_type& a = {}) -> tree;
+template<class I> auto new_ZoneSubRegion(const std::string& name, I dim, const std::string& gridLoc, const tree::allocator_type& a = {}) -> tree;
 
-template<class I> auto new_PointRange(I first, I last) -> tree;
-template<class I> auto new_ElementRange(I first, I last) -> tree;
+template<class I> auto new_PointRange(I first, I last, const tree::allocator_type& a = {}) -> tree;
+template<class I> auto new_ElementRange(I first, I last, const tree::allocator_type& a = {}) -> tree;
 
 template<class I> auto
-new_Elements(const std::string& name, I type, std::vector<I>&& connectivity, I first, I last, I nb_bnd_elts = 0) -> tree;
+new_Elements(const std::string& name, I type, std::vector<I>&& connectivity, I first, I last, I nb_bnd_elts = 0, const tree::allocator_type& a = {}) -> tree;
 template<class I> auto
-new_Elements(const std::string& name, ElementType_t type, std::vector<I>&& connectivity, I first, I last, I nb_bnd_elts = 0) -> tree;
+new_Elements(const std::string& name, ElementType_t type, std::vector<I>&& connectivity, I first, I last, I nb_bnd_elts = 0, const tree::allocator_type& a = {}) -> tree;
 template<class I> auto
-new_HomogenousElements(const std::string& name, I type, md_array<I,2>&& connectivity, I first, I last, I nb_bnd_elts=0) -> tree;
+new_HomogenousElements(const std::string& name, I type, md_array<I,2>&& connectivity, I first, I last, I nb_bnd_elts=0, const tree::allocator_type& a = {}) -> tree;
 template<class I> auto
-new_NgonElements(const std::string& name, std::vector<I>&& connectivity, I first, I last, I nb_bnd_elts=0) -> tree;
+new_NgonElements(const std::string& name, std::vector<I>&& connectivity, I first, I last, I nb_bnd_elts=0, const tree::allocator_type& a = {}) -> tree;
 template<class I> auto
-new_NfaceElements(const std::string& name, std::vector<I>&& connectivity, I first, I last) -> tree;
+new_NfaceElements(const std::string& name, std::vector<I>&& connectivity, I first, I last, const tree::allocator_type& a = {}) -> tree;
 
-template<class I> auto new_PointList(const std::string& name, std::vector<I>&& pl) -> tree;
-template<class I> auto new_PointList(const std::string& name, std::initializer_list<I> pl) -> tree;
+template<class I> auto new_PointList(const std::string& name, std::vector<I>&& pl, const tree::allocator_type& a = {}) -> tree;
+template<class I> auto new_PointList(const std::string& name, std::initializer_list<I> pl, const tree::allocator_type& a = {}) -> tree;
 
-template<class I> auto new_BC(const std::string& name, const std::string& loc, std::vector<I>&& point_list) -> tree;
-template<class I> auto new_BC(const std::string& name, const std::string& loc, std::initializer_list<I> pl) -> tree;
+template<class I> auto new_BC(const std::string& name, const std::string& loc, std::vector<I>&& point_list, const tree::allocator_type& a = {}) -> tree;
+template<class I> auto new_BC(const std::string& name, const std::string& loc, std::initializer_list<I> pl, const tree::allocator_type& a = {}) -> tree;
 
-template<class I> auto new_Rind(std::vector<I>&& rind_planes) -> tree;
+template<class I> auto new_Rind(std::vector<I>&& rind_planes, const tree::allocator_type& a = {}) -> tree;
 
-template<class I> auto new_Ordinal(I i) -> tree;
+template<class I> auto new_Ordinal(I i, const tree::allocator_type& a = {}) -> tree;
 
-template<class I> auto new_Distribution(const std::string& entity_kind, std::vector<I>&& partial_dist) -> tree;
-template<class I> auto new_ElementDistribution(std::vector<I>&& partial_dist) -> tree;
-template<class I> auto new_ElementDistribution(std::vector<I>&& partial_dist, std::vector<I>&& partial_dist_connec) -> tree;
+template<class I> auto new_Distribution(const std::string& entity_kind, std::vector<I>&& partial_dist, const tree::allocator_type& a = {}) -> tree;
+template<class I> auto new_ElementDistribution(std::vector<I>&& partial_dist, const tree::allocator_type& a = {}) -> tree;
+template<class I> auto new_ElementDistribution(std::vector<I>&& partial_dist, std::vector<I>&& partial_dist_connec, const tree::allocator_type& a = {}) -> tree;
 // [Sphinx Doc] creation according to SIDS }
 
 
 // ====================== impl ======================
 
 template<class I> auto
-new_CGNSBase(const std::string& name, I cellDim, I physDim) -> tree {
-  return {name, "CGNSBase_t", node_value({cellDim,physDim})};
+new_CGNSBase(const std::string& name, I cellDim, I physDim, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "CGNSBase_t", node_value({cellDim,physDim})};
 }
 
 template<class I> auto
-new_UnstructuredZone(const std::string& name, const I(&dims)[3]) -> tree {
-  tree z_type = {"ZoneType", "ZoneType_t", node_value("Unstructured"), {}};
-  return {name, "Zone_t", node_value({{dims[0],dims[1],dims[2]}}), {std::move(z_type)}};
+new_UnstructuredZone(const std::string& name, const I(&dims)[3], const tree::allocator_type& a) -> tree {
+  tree z_type = {std::allocator_arg, a, "ZoneType", "ZoneType_t", node_value("Unstructured")};
+  return {std::allocator_arg, a, name, "Zone_t", node_value({{dims[0],dims[1],dims[2]}}), {std::move(z_type)}};
 }
 template<class I> auto
-new_ZoneSubRegion(const std::string& name, I dim, const std::string& gridLoc) -> tree {
-  return {name, "ZoneSubRegion_t", node_value(dim), {new_GridLocation(gridLoc)}};
+new_ZoneSubRegion(const std::string& name, I dim, const std::string& gridLoc, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "ZoneSubRegion_t", node_value(dim), {new_GridLocation(gridLoc,a)}};
 }
 
 
 template<class I> auto
-new_PointRange(I first, I last) -> tree {
-  return {"PointRange", "IndexRange_t", node_value({{first,last}})};
+new_PointRange(I first, I last, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "PointRange", "IndexRange_t", node_value({{first,last}})};
 }
 template<class I> auto
-new_ElementRange(I first, I last) -> tree {
-  return {"ElementRange", "IndexRange_t", node_value({first,last}), {}};
+new_ElementRange(I first, I last, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "ElementRange", "IndexRange_t", node_value({first,last})};
 }
 
 
 template<class I> auto
 new_Elements(
   const std::string& name, I type, std::vector<I>&& conns,
-  I first, I last, I nb_bnd_elts)
+  I first, I last, I nb_bnd_elts, const tree::allocator_type& a)
 -> tree
 {
   return
-    { name, "Elements_t", node_value({type,nb_bnd_elts}),
-       { new_ElementRange(first,last) ,
-         new_DataArray("ElementConnectivity", node_value(std::move(conns))) } };
+    { std::allocator_arg, a, name, "Elements_t", node_value({type,nb_bnd_elts}),
+       { new_ElementRange(first,last,a) ,
+         new_DataArray("ElementConnectivity", node_value(std::move(conns)), a) } };
 }
 template<class I> auto
 new_Elements(
   const std::string& name, ElementType_t type, std::vector<I>&& conns,
-  I first, I last, I nb_bnd_elts)
+  I first, I last, I nb_bnd_elts, const tree::allocator_type& a)
 -> tree
 {
-  return new_Elements(name,(I)type,std::move(conns),first,last,nb_bnd_elts);
+  return new_Elements(name,(I)type,std::move(conns),first,last,nb_bnd_elts,a);
 }
 
 template<class I> auto
 new_HomogenousElements(
   const std::string& name, I type, md_array<I,2>&& conns,
-  I first, I last, I nb_bnd_elts)
+  I first, I last, I nb_bnd_elts, const tree::allocator_type& a)
 -> tree {
-  return new_Elements(name,type,std::move(conns.underlying_range()),first,last,nb_bnd_elts);
+  return new_Elements(name,type,std::move(conns.underlying_range()),first,last,nb_bnd_elts,a);
 }
 
 template<class I> auto
-new_NgonElements(const std::string& name, std::vector<I>&& conns, I first, I last, I nb_bnd_elts) -> tree {
+new_NgonElements(const std::string& name, std::vector<I>&& conns, I first, I last, I nb_bnd_elts, const tree::allocator_type& a) -> tree {
   I ngon_type = NGON_n;
-  return new_Elements(name,ngon_type,std::move(conns),first,last,nb_bnd_elts);
+  return new_Elements(name,ngon_type,std::move(conns),first,last,nb_bnd_elts,a);
 }
 template<class I> auto
-new_NfaceElements(const std::string& name, std::vector<I>&& conns, I first, I last) -> tree {
+new_NfaceElements(const std::string& name, std::vector<I>&& conns, I first, I last, const tree::allocator_type& a) -> tree {
   I nface_type = NFACE_n;
-  return new_Elements(name,nface_type,std::move(conns),first,last,0);
+  return new_Elements(name,nface_type,std::move(conns),first,last,I(0),a);
 }
 
 template<class I> auto
@@ -157,83 +160,83 @@ new_IndexArray(const std::string& name, std::initializer_list<I> pl) -> tree {
 }
 
 template<class I> auto
-new_PointList(const std::string& name, std::vector<I>&& point_list) -> tree {
+new_PointList(const std::string& name, std::vector<I>&& point_list, const tree::allocator_type& a) -> tree {
   std::vector<I8> dims = {1,(I8)point_list.size()}; // required by SIDS (9.3: BC_t)
   node_value pl_value(std::move(point_list),std::move(dims));
-  return {name, "IndexArray_t", std::move(pl_value)};
+  return {std::allocator_arg, a, name, "IndexArray_t", std::move(pl_value)};
 }
 template<class I> auto
-new_PointList(const std::string& name, std::initializer_list<I> pl) -> tree {
-  return new_PointList(name,std::vector(pl.begin(),pl.end()));
+new_PointList(const std::string& name, std::initializer_list<I> pl, const tree::allocator_type& a) -> tree {
+  return new_PointList(name,std::vector(pl.begin(),pl.end()),a);
 }
 
 template<class I> auto
-new_BC(const std::string& name, const std::string& loc, std::vector<I>&& point_list) -> tree {
+new_BC(const std::string& name, const std::string& loc, std::vector<I>&& point_list, const tree::allocator_type& a) -> tree {
   return
-    { name, "BC_t", node_value("FamilySpecified"),
-       { new_GridLocation(loc),
-         new_PointList("PointList",std::move(point_list)) } };
+    { std::allocator_arg, a, name, "BC_t", node_value("FamilySpecified"),
+       { new_GridLocation(loc,a),
+         new_PointList("PointList",std::move(point_list),a) } };
 }
 template<class I> auto
-new_BC(const std::string& name, const std::string& loc, std::initializer_list<I> pl) -> tree {
-  return new_BC(name,loc,std::vector(pl.begin(),pl.end()));
+new_BC(const std::string& name, const std::string& loc, std::initializer_list<I> pl, const tree::allocator_type& a) -> tree {
+  return new_BC(name,loc,std::vector(pl.begin(),pl.end()),a);
 }
 
 template<class I> auto
-new_Rind(std::vector<I>&& rind_planes) -> tree {
-  return {"Rind", "Rind_t", node_value(std::move(rind_planes))};
+new_Rind(std::vector<I>&& rind_planes, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "Rind", "Rind_t", node_value(std::move(rind_planes))};
 }
 
 template<class I> auto
-new_Ordinal(I i) -> tree {
-  return {"Ordinal", "Ordinal_t", node_value(i)};
+new_Ordinal(I i, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, "Ordinal", "Ordinal_t", node_value(i)};
 }
 
 template<class I> auto
-new_Distribution(const std::string& entity_kind, std::vector<I>&& partial_dist) -> tree {
-  tree vtx_dist = cgns::new_DataArray(entity_kind,std::move(partial_dist));
-  tree dist = cgns::new_UserDefinedData(":CGNS#Distribution");
+new_Distribution(const std::string& entity_kind, std::vector<I>&& partial_dist, const tree::allocator_type& a) -> tree {
+  tree vtx_dist = cgns::new_DataArray(entity_kind,std::move(partial_dist),a);
+  tree dist = cgns::new_UserDefinedData(":CGNS#Distribution",MT(),a);
   emplace_child(dist,std::move(vtx_dist));
   return dist;
 }
 template<class I> auto
-new_ElementDistribution(std::vector<I>&& partial_dist) -> tree {
-  return new_Distribution("Element",std::move(partial_dist));
+new_ElementDistribution(std::vector<I>&& partial_dist, const tree::allocator_type& a) -> tree {
+  return new_Distribution("Element",std::move(partial_dist),a);
 }
 template<class I> auto
-new_ElementDistribution(std::vector<I>&& partial_dist, std::vector<I>&& partial_dist_connec) -> tree {
-  tree elt_dist = cgns::new_DataArray("Element",std::move(partial_dist));
-  tree connec_dist = cgns::new_DataArray("ElementConnectivity",std::move(partial_dist_connec));
-  tree dist = cgns::new_UserDefinedData(":CGNS#Distribution");
+new_ElementDistribution(std::vector<I>&& partial_dist, std::vector<I>&& partial_dist_connec, const tree::allocator_type& a) -> tree {
+  tree elt_dist = cgns::new_DataArray("Element",std::move(partial_dist),a);
+  tree connec_dist = cgns::new_DataArray("ElementConnectivity",std::move(partial_dist_connec),a);
+  tree dist = cgns::new_UserDefinedData(":CGNS#Distribution",MT(),a);
   emplace_child(dist,std::move(elt_dist));
   emplace_child(dist,std::move(connec_dist));
   return dist;
 }
 
 template<class T> auto
-new_UserDefinedData(const std::string& name, const T& val) -> tree {
-  return {name, "UserDefinedData_t", node_value(val)};
+new_UserDefinedData(const std::string& name, const T& val, const tree::allocator_type& a) -> tree {
+  return {std::allocator_arg, a, name, "UserDefinedData_t", node_value(val)};
 }
 template<class T> auto
-new_UserDefinedData(const std::string& name, std::vector<T>&& v) -> tree {
-  return new_UserDefinedData(name,node_value(std::move(v)));
+new_UserDefinedData(const std::string& name, std::vector<T>&& v, const tree::allocator_type& a) -> tree {
+  return new_UserDefinedData(name,node_value(std::move(v)),a);
 }
 
 template<class T> auto
-new_DataArray(const std::string& name, std::initializer_list<T>&& arr) -> tree {
-  return {name, "DataArray_t", node_value(std::move(arr))};
+new_DataArray(const std::string& name, std::initializer_list<T>&& arr, const tree::allocator_type& a = {}) -> tree {
+  return {std::allocator_arg, a, name, "DataArray_t", node_value(std::move(arr))};
 }
 template<class T> auto
-new_DataArray(const std::string& name, std::vector<T>&& v) -> tree {
-  return new_DataArray(name,node_value(std::move(v)));
+new_DataArray(const std::string& name, std::vector<T>&& v, const tree::allocator_type& a) -> tree {
+  return new_DataArray(name,node_value(std::move(v)),a);
 }
 template<class T, int rank> auto
-new_DataArray(const std::string& name, md_array<T,rank>&& arr) -> tree {
-  return new_DataArray(name,node_value(std::move(arr)));
+new_DataArray(const std::string& name, md_array<T,rank>&& arr, const tree::allocator_type& a) -> tree {
+  return new_DataArray(name,node_value(std::move(arr)),a);
 }
 template<class T, int rank> auto
-new_DataArray(const std::string& name, md_array_view<T,rank>& arr) -> tree {
-  return new_DataArray(name,node_value(std::move(arr)));
+new_DataArray(const std::string& name, md_array_view<T,rank>& arr, const tree::allocator_type& a) -> tree {
+  return new_DataArray(name,node_value(std::move(arr)),a);
 }
 
 
@@ -0,0 +1,26 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+
+#include "cpp_cgns/sids/creation.hpp"
+#include "cpp_cgns/base/tree_arena.hpp"
+
+using namespace cgns;
+
+TEST_CASE("creation in a tree_arena") {
+  tree_arena arena;
+  auto a = arena.allocator();
+
+  tree b = new_CGNSBase("Base",3,3,a);
+  tree& z = emplace_child(b,new_UnstructuredZone("Z0",{9,4,0},a));
+  tree& elts = emplace_child(z,new_Elements("Tets",(I4)TETRA_4,std::vector<I4>{1,2,3,4},1,1,0,a));
+
+  CHECK( children(b).get_allocator().resource() == arena.resource() );
+  CHECK( children(z).get_allocator().resource() == arena.resource() );
+  CHECK( children(child(z,0)).get_allocator().resource() == arena.resource() ); // ZoneType
+  CHECK( children(elts).get_allocator().resource() == arena.resource() );
+  CHECK( children(child(elts,1)).get_allocator().resource() == arena.resource() ); // ElementConnectivity
+
+  tree z_default = new_UnstructuredZone<I4>("Z1");
+  CHECK( children(z_default).get_allocator().resource() == std::pmr::get_default_resource() );
+}
+#endif // C++>17
@@ -16,7 +16,7 @@ correct_bc_data_arrays_according_to_SIDS(tree& bcdata_node) -> void {
   // SIDS: boundary field should have shape {1,PointList size}
   tree_range bcdata_array_nodes = get_children_by_label(bcdata_node,"DataArray_t");
   for (tree& bcdata_array_node : bcdata_array_nodes) {
-    cons_reshape(value(bcdata_array_node),{1,value(bcdata_array_node).extent(0)});
+    cons_reshape(mutable_value(bcdata_array_node),{1,value(bcdata_array_node).extent(0)});
   }
 }
 
@@ -113,12 +113,16 @@ PointListDonor(Tree& t) {
 }
 
 
-template<class I> auto
-get_zone_point_lists(tree& z, const std::string& grid_location) -> std::vector<std_e::span<I>> {
+/// with a const zone, the point lists are read-only views, and values shared by `cow_clone` are not copied
+template<class I, class Tree> auto
+get_zone_point_lists(Tree& z, const std::string& grid_location) {
   STD_E_ASSERT(label(z)=="Zone_t");
-  std::vector<std::string> search_gen_paths = {"ZoneBC/BC_t","ZoneGridConnectivity/GridConnectivity_t"}; // TODO and other places!
-  std::vector<std_e::span<I>> pls;
-  for (tree& bc : get_nodes_by_matching(z,search_gen_paths)) {
+  static const std::vector<compiled_path> search_paths = { // TODO and other places!
+    compiled_path("ZoneBC/BC_t"),
+    compiled_path("ZoneGridConnectivity/GridConnectivity_t")
+  };
+  std::vector<decltype(get_child_value_by_name<I>(z,"PointList"))> pls;
+  for (Tree& bc : get_nodes_by_matching(z,search_paths)) {
     if (GridLocation(bc)==grid_location) {
       pls.emplace_back(get_child_value_by_name<I>(bc,"PointList"));
     }
@@ -131,4 +131,44 @@ TEST_CASE("dispatch_on_data_type") {
   CHECK( my_complete_node_query(my_R8_node_value) == true  );
 }
 // Test dispatch_on_data_type }
+
+
+
+
+// Test multi-argument dispatch {
+TEST_CASE("multi-argument dispatch") {
+  node_value connectivity = {I4(2),I4(0),I4(1)};
+  node_value coordinates = {R8(10.),R8(20.),R8(30.)};
+
+  // [Sphinx Doc] multi-argument dispatch example {
+  auto sum_of_indexed = [&]<class I, class R>(I, R){
+    const I* idx = data_as<I>(connectivity);
+    const R* x = data_as<R>(coordinates);
+    R sum = 0;
+    for (size_t i=0; i<connectivity.size(); ++i) {
+      sum += x[idx[i]];
+    }
+    return double(sum);
+  };
+  // only instantiates the I4/I8 x R4/R8 combinations
+  double s = dispatch<integral_data_types,floating_data_types>(sum_of_indexed,connectivity,coordinates);
+  CHECK( s == 60. );
+  // [Sphinx Doc] multi-argument dispatch example }
+
+  SUBCASE("no restriction") {
+    auto sizes = []<class T0, class T1>(T0, T1){ return int(sizeof(T0)*10 + sizeof(T1)); };
+    CHECK( dispatch(sizes,my_C1_node_value,my_R8_node_value) == 18 );
+    CHECK( dispatch(sizes,my_I8_node_value,my_R4_node_value) == 84 );
+  }
+  SUBCASE("same restriction for all arguments") {
+    auto n_bytes = []<class... Ts>(Ts...){ return int((sizeof(Ts) + ...)); };
+    CHECK( dispatch<integral_data_types>(n_bytes,my_I4_node_value,my_I8_node_value,my_I4_node_value) == 16 );
+    CHECK_THROWS_AS( dispatch<integral_data_types>(n_bytes,my_I4_node_value,my_R8_node_value) , const cgns_exception& );
+  }
+  SUBCASE("empty value") {
+    auto f = []<class T>(T){ return 0; };
+    CHECK_THROWS_AS( dispatch(f,MT()) , const cgns_exception& );
+  }
+}
+// Test multi-argument dispatch }
 #endif // C++>17
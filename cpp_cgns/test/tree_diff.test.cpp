@@ -0,0 +1,80 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/tree_diff.hpp"
+
+using namespace cgns;
+
+TEST_CASE("tree_diff") {
+  std::vector<R8> big(100);
+  for (int i=0; i<100; ++i) big[i] = i;
+  tree x = {
+    "Base", "CGNSBase_t", node_value({3,3}), {
+      tree{"Zone0", "Zone_t", MT(), {
+          tree{"GridCoordinates", "GridCoordinates_t", MT(), {
+              tree{"CoordinateX", "DataArray_t", node_value(std::move(big))} } },
+          tree{"ZoneBC", "ZoneBC_t", MT()} } },
+      tree{"Zone1", "Zone_t", MT()},
+      tree{"Family", "Family_t", MT()} }
+  };
+  tree y = clone(x);
+
+  SUBCASE("identical trees") {
+    CHECK( tree_diff(x,y).size() == 0 );
+  }
+
+  SUBCASE("value range change") {
+    R8* coord_x = data_as<R8>(mutable_value(child(child(child(y,0),0),0)));
+    coord_x[10] = -1.;
+    coord_x[12] = -1.;
+    coord_x[90] = -1.;
+
+    tree_patch patch = tree_diff(x,y);
+    REQUIRE( patch.size() == 2 );
+    const auto& op0 = std::get<set_value_range_op>(patch[0]);
+    CHECK( op0.path == "Zone0/GridCoordinates/CoordinateX" );
+    CHECK( op0.start == 10 );
+    CHECK( op0.new_elements == std::vector<R8>{-1.,11.,-1.} );
+    const auto& op1 = std::get<set_value_range_op>(patch[1]);
+    CHECK( op1.start == 90 );
+
+    apply_patch(x,std::move(patch));
+    CHECK( x == y );
+  }
+
+  SUBCASE("structural changes") {
+    // [Sphinx Doc] tree diff {
+    rm_child_by_name(y,"Family");
+    name(child(y,1)) = "Zone1_renamed";
+    label(child(y,0)) = "UserDefinedData_t";
+    set_value(y,node_value({3,2}));
+    emplace_child(child(y,0),tree{"FlowSolution", "FlowSolution_t", MT()});
+
+    tree_patch patch = tree_diff(x,y);
+    CHECK( patch.size() == 5 ); // value of "Base", rm "Family", rename "Zone1", relabel "Zone0", add "FlowSolution"
+
+    apply_patch(x,std::move(patch));
+    CHECK( x == y );
+    // [Sphinx Doc] tree diff }
+  }
+
+  SUBCASE("reordered children") {
+    rm_child_by_name(y,"Zone0");
+    emplace_child(y,clone(x)); // new child "Base", at the end
+    emplace_child(y,clone(child(x,0))); // back to the end: order is Zone1, Family, Base, Zone0
+
+    tree_patch patch = tree_diff(x,y);
+    CHECK( std::holds_alternative<reorder_children_op>(patch.back()) );
+
+    apply_patch(x,std::move(patch));
+    CHECK( x == y );
+  }
+
+  SUBCASE("different root name") {
+    name(y) = "Base2";
+    tree_patch patch = tree_diff(x,y);
+    CHECK( patch.size() == 1 );
+    apply_patch(x,std::move(patch));
+    CHECK( x == y );
+  }
+}
+#endif // C++>17
@@ -14,6 +14,165 @@ TEST_CASE("get_node_by_matching") {
 
   tree& bc = cgns::get_node_by_matching(z,"ZoneBC/BC_t");
   CHECK( name(bc) == "MyBC_0" );
+
+  SUBCASE("compiled path") {
+    const compiled_path path("ZoneBC/BC_t");
+    CHECK( path.size() == 2 );
+    CHECK( name(get_node_by_matching(z,path)) == "MyBC_0" );
+    CHECK( get_nodes_by_matching(z,path).size() == 1 );
+    CHECK( has_node(z,path) );
+    CHECK_FALSE( has_node(z,compiled_path("ZoneBC/Family_t")) );
+  }
+  SUBCASE("compiled path - along_path") {
+    auto filter = along_path(compiled_path("ZoneBC/BC_t"));
+    CHECK( filter(get_child_by_name(z,"ZoneBC"),1) );
+    CHECK_FALSE( filter(get_child_by_name(z,"ZoneType"),1) );
+    CHECK( filter(bc,2) );
+    CHECK( filter(get_child_by_name(bc,"GridLocation"),3) ); // below the end of the path
+  }
+  SUBCASE("compiled path - components are not interned as labels") {
+    const compiled_path path("ZoneBC/Compiled_path_test_t");
+    CHECK_FALSE( node_label::find("Compiled_path_test_t") );
+    CHECK_FALSE( has_node(z,path) );
+
+    emplace_child(get_child_by_name(z,"ZoneBC"),tree{"MyNode", "Compiled_path_test_t", MT()}); // label interned after the compilation
+    CHECK( name(get_node_by_matching(z,path)) == "MyNode" );
+  }
+  SUBCASE("wildcard") {
+    auto ns = get_nodes_by_matching(z,compiled_path("*/BC_t"));
+    CHECK( ns.size() == 2 );
+    CHECK( name(ns[0]) == "Wrong" );
+    CHECK( name(ns[1]) == "MyBC_0" );
+
+    CHECK( name(get_node_by_matching(z,"ZoneBC/*/GridLocation")) == "GridLocation" );
+  }
+}
+
+TEST_CASE("search children by name") {
+  // enough children for the name index to be used
+  int n = 2*tree_children::name_index_min_size;
+  tree t = {"Base", "CGNSBase_t", MT()};
+  for (int i=0; i<n; ++i) {
+    emplace_child(t,tree{"Zone_"+std::to_string(i), "Zone_t", MT()});
+  }
+
+  CHECK( has_child_of_name(t,"Zone_0") );
+  CHECK( has_child_of_name(t,"Zone_"+std::to_string(n-1)) );
+  CHECK_FALSE( has_child_of_name(t,"Zone_"+std::to_string(n)) );
+  CHECK( label(get_child_by_name(t,"Zone_7")) == "Zone_t" );
+  CHECK_THROWS_AS( get_child_by_name(t,"Unknown"), const cgns_exception& );
+
+  SUBCASE("names too long to be node names") {
+    std::string long_name(node_name::max_size+1,'Z');
+    CHECK_FALSE( has_child_of_name(t,long_name) ); // not found, rather than an invalid node_name
+    CHECK( get_nodes_by_name(t,long_name).size() == 0 );
+    CHECK( get_children_by_name_or_label(t,long_name).size() == 0 );
+    CHECK_THROWS_AS( get_child_by_name(t,long_name), const cgns_exception& );
+    CHECK_THROWS_AS( rm_child_by_name(t,long_name), const cgns_exception& );
+    CHECK( children(t).size() == size_t(n) );
+  }
+  SUBCASE("add child") {
+    emplace_child(t,tree{"Family", "Family_t", MT()});
+    CHECK( label(get_child_by_name(t,"Family")) == "Family_t" );
+  }
+  SUBCASE("remove child") {
+    rm_child_by_name(t,"Zone_3");
+    CHECK_FALSE( has_child_of_name(t,"Zone_3") );
+    CHECK( name(get_child_by_name(t,"Zone_4")) == "Zone_4" );
+    CHECK( children(t).size() == size_t(n-1) );
+  }
+  SUBCASE("rename child") {
+    name(child(t,5)) = "Renamed";
+    CHECK( has_child_of_name(t,"Renamed") );
+    CHECK_FALSE( has_child_of_name(t,"Zone_5") );
+  }
+  SUBCASE("replace child in place") {
+    auto& cs = children(t);
+    cs.erase(cs.begin()+5);
+    cs.push_back(tree{"Family", "Family_t", MT()}); // same number of children as when the index was built
+    CHECK( label(get_child_by_name(t,"Family")) == "Family_t" );
+    CHECK_FALSE( has_child_of_name(t,"Zone_5") );
+    CHECK( name(get_child_by_name(t,"Zone_6")) == "Zone_6" );
+  }
+  SUBCASE("assign child") {
+    child(t,5) = tree{"Family", "Family_t", MT()};
+    CHECK( label(get_child_by_name(t,"Family")) == "Family_t" );
+    CHECK_FALSE( has_child_of_name(t,"Zone_5") );
+  }
+  SUBCASE("remove a child having the same name as another one") {
+    emplace_child(t,tree{"Zone_3", "Family_t", MT()});
+    rm_child_by_name(t,"Zone_3");
+    CHECK( label(get_child_by_name(t,"Zone_3")) == "Family_t" );
+    CHECK( name(get_child_by_name(t,"Zone_4")) == "Zone_4" );
+  }
+}
+
+TEST_CASE("replace_children keeps the name index up-to-date") {
+  int n = 1000;
+  tree t = {"Base", "CGNSBase_t", MT()};
+  for (int i=0; i<n; ++i) {
+    emplace_child(t,tree{"Zone_"+std::to_string(i), "Zone_t", MT()});
+  }
+  CHECK( has_child_of_name(t,"Zone_0") ); // the index is built here
+
+  std::vector<tree> new_children;
+  for (int i=0; i<n; i+=2) {
+    new_children.push_back(tree{"Zone_"+std::to_string(i), "Family_t", MT()});
+  }
+  new_children.push_back(tree{"Family", "Family_t", MT()});
+
+  auto n_builds = tree_children::number_of_name_index_builds();
+  replace_children(t,std::move(new_children));
+  CHECK( children(t).size() == size_t(n+1) );
+  CHECK( label(get_child_by_name(t,"Zone_2")) == "Family_t" );
+  CHECK( label(get_child_by_name(t,"Zone_3")) == "Zone_t" );
+  CHECK( has_child_of_name(t,"Family") );
+  CHECK_FALSE( has_child_of_name(t,"Zone_"+std::to_string(n)) );
+  CHECK( name(child(t,n-1)) == "Zone_"+std::to_string(n-2) ); // replaced children are put at the end
+  CHECK( tree_children::number_of_name_index_builds() == n_builds ); // updated, never rebuilt
+}
+
+TEST_CASE("remove children") {
+  tree t = {"Zone", "Zone_t", MT()};
+  for (int i=0; i<40; ++i) {
+    emplace_child(t,tree{"BC_"+std::to_string(i), i%2==0 ? "BC_t" : "FlowSolution_t", MT()});
+  }
+
+  SUBCASE("rm_children_by_names") {
+    rm_children_by_names(t,{"BC_0","BC_13","BC_39"});
+    CHECK( children(t).size() == 37 );
+    CHECK_FALSE( has_child_of_name(t,"BC_13") );
+    CHECK( name(child(t,0)) == "BC_1" ); // order is preserved
+    CHECK( name(child(t,36)) == "BC_38" );
+
+    CHECK_THROWS_AS( rm_children_by_names(t,{"BC_1","BC_0"}), const cgns_exception& );
+    CHECK( has_child_of_name(t,"BC_1") ); // nothing removed if one name is not found
+  }
+  SUBCASE("rm_children_by_names - only the first child of each name") {
+    emplace_child(t,tree{"BC_0", "Family_t", MT()});
+    rm_children_by_names(t,{"BC_0"});
+    CHECK( children(t).size() == 40 );
+    CHECK( label(get_child_by_name(t,"BC_0")) == "Family_t" );
+
+    CHECK_THROWS_AS( rm_children_by_names(t,{"BC_0","BC_0"}), const cgns_exception& );
+    CHECK( children(t).size() == 40 );
+  }
+
+  SUBCASE("rm_children") {
+    auto sols = get_children_by_label(t,"FlowSolution_t");
+    rm_children(t,sols);
+    CHECK( children(t).size() == 20 );
+    CHECK( name(child(t,1)) == "BC_2" );
+    CHECK( has_child_of_name(t,"BC_38") );
+    CHECK_FALSE( has_child_of_name(t,"BC_39") );
+  }
+
+  SUBCASE("rm_children_by_labels") {
+    rm_children_by_labels(t,{"FlowSolution_t","Family_t"});
+    CHECK( children(t).size() == 20 );
+    rm_children_by_label(t,"BC_t");
+    CHECK( children(t).size() == 0 );
+  }
 }
 
 TEST_CASE("find nodes") {
@@ -106,6 +265,41 @@ TEST_CASE("find nodes") {
     CHECK( label(n1) == "A_t" );
   }
 
+  SUBCASE("get_node_by_name") {
+    CHECK( label(get_node_by_name(t,"D")) == "A_t" ); // first in preorder
+    CHECK( name(get_node_by_name(t,"A")) == "A" ); // the root is included
+    CHECK_THROWS_AS( get_node_by_name(t,"D",1), const cgns_exception& ); // "D" nodes are at depth 2
+    CHECK_THROWS_AS( get_node_by_name(t,"Unknown"), const cgns_exception& );
+  }
+
+  SUBCASE("get_node_by_label") {
+    CHECK( name(get_node_by_label(t,"D_t")) == "D" );
+    CHECK( name(get_node_by_label(t,"B_t",1)) == "B0" );
+    CHECK_THROWS_AS( get_node_by_label(t,"D_t",1), const cgns_exception& );
+  }
+  SUBCASE("unknown labels are not interned by searches") {
+    std::string unknown = "Tree_manip_query_test_t";
+    CHECK_FALSE( has_child_of_label(t,unknown) );
+    CHECK( get_children_by_label(t,unknown).size() == 0 );
+    CHECK( get_nodes_by_label(t,unknown).size() == 0 );
+    CHECK_FALSE( is_of_label(t,unknown) );
+    CHECK_THROWS_AS( get_child_by_label(t,unknown), const cgns_exception& );
+    CHECK_THROWS_AS( get_node_by_label(t,unknown), const cgns_exception& );
+    CHECK_THROWS_AS( rm_child_by_label(t,unknown), const cgns_exception& );
+    rm_children_by_label(t,unknown);
+    CHECK( std::ranges::distance(children_by_label(t,unknown)) == 0 );
+    CHECK( std::ranges::distance(nodes_by_label(t,unknown)) == 0 );
+    CHECK_FALSE( node_label::find(unknown) );
+  }
+
+  SUBCASE("get_node_by_predicate") {
+    const tree& ct = t;
+    auto has_no_children = [](const tree& n){ return children(n).size()==0; };
+    const tree& n = get_node_by_predicate(ct,has_no_children);
+    CHECK( label(n) == "A_t" );
+    CHECK( name(n) == "D" );
+  }
+
   SUBCASE("get values") {
     std_e::span<I4> val_A = get_child_value_by_name<I4>(t,"B0");
     CHECK( val_A.size() == 3 );
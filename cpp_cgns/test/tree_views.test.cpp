@@ -0,0 +1,84 @@
+#if __cplusplus > 201703L
+#include "std_e/unit_test/doctest.hpp"
+#include "cpp_cgns/tree_views.hpp"
+
+using namespace cgns;
+
+TEST_CASE("tree views") {
+  tree t = {
+    "A", "A_t", MT(), {
+      tree{"B0", "B_t", MT(), {
+          tree{"D", "A_t", MT(), {
+              tree{"E", "E_t", MT()} } } } },
+      tree{"B1", "B_t", MT(), {
+          tree{"D", "D_t", MT()} } },
+      tree{"C", "C_t", MT()} }
+  };
+
+  SUBCASE("children") {
+    std::vector<std::string> names;
+    for (const tree& c : children_by_label(t,"B_t")) {
+      names.push_back(to_string(name(c)));
+    }
+    CHECK( names == std::vector<std::string>{"B0","B1"} );
+
+    CHECK( std::ranges::distance(children_by_name(t,"C")) == 1 );
+    CHECK( std::ranges::distance(children_by_name(t,"D")) == 0 );
+  }
+
+  SUBCASE("preorder") {
+    std::vector<std::string> names;
+    for (const tree& n : preorder_nodes(t)) {
+      names.push_back(to_string(name(n)));
+    }
+    CHECK( names == std::vector<std::string>{"A","B0","D","E","B1","D","C"} );
+  }
+
+  SUBCASE("preorder with max depth") {
+    std::vector<std::string> names;
+    for (const tree& n : preorder_nodes(t,1)) {
+      names.push_back(to_string(name(n)));
+    }
+    CHECK( names == std::vector<std::string>{"A","B0","B1","C"} );
+  }
+
+  SUBCASE("nodes_by_label") {
+    std::vector<std::string> names;
+    for (const tree& n : nodes_by_label(t,"A_t")) {
+      names.push_back(to_string(name(n)));
+    }
+    CHECK( names == std::vector<std::string>{"A","D"} );
+  }
+
+  SUBCASE("nodes_by_name -- modify through the view") {
+    for (tree& n : nodes_by_name(t,"D")) {
+      name(n) = "D_renamed";
+    }
+    CHECK( name(child(child(t,0),0)) == "D_renamed" );
+    CHECK( name(child(child(t,1),0)) == "D_renamed" );
+  }
+
+  SUBCASE("nodes_by_matching") {
+    const tree& ct = t;
+    compiled_path path("B_t/D");
+    std::vector<std::string> labels;
+    for (const tree& n : nodes_by_matching(ct,path)) {
+      labels.push_back(to_string(label(n)));
+    }
+    CHECK( labels == std::vector<std::string>{"A_t","D_t"} );
+  }
+
+  SUBCASE("deep trees") {
+    // deeper than the inline traversal stack
+    tree deep = {"N_0", "N_t", MT()};
+    tree* leaf = &deep;
+    for (int i=1; i<40; ++i) {
+      leaf = &emplace_child(*leaf,tree{"N_"+std::to_string(i), "N_t", MT()});
+    }
+    emplace_child(deep,tree{"Last", "N_t", MT()});
+
+    CHECK( std::ranges::distance(preorder_nodes(deep)) == 41 );
+    CHECK( name(*nodes_by_name(deep,"Last").begin()) == "Last" );
+  }
+}
+#endif // C++>17
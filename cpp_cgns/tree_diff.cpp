@@ -0,0 +1,330 @@
+#if __cplusplus > 201703L
+#include "cpp_cgns/tree_diff.hpp"
+
+
+#include <cstring>
+#include <unordered_map>
+#include "cpp_cgns/base/tree_digest.hpp"
+#include "cpp_cgns/base/hash.hpp"
+#include "cpp_cgns/tree_manip.hpp"
+#include "cpp_cgns/dispatch.hpp"
+#include "std_e/utils/string.hpp"
+
+
+namespace cgns {
+
+
+namespace {
+
+// utils {
+auto
+join_path(const std::string& parent_path, const node_name& n) -> std::string {
+  if (parent_path.empty()) return to_string(n);
+  return parent_path + "/" + n;
+}
+
+/// preorder indices (in the tree_digest) of the children of node `i`
+auto
+children_indices(const tree_digest& d, tree_digest::index_type i) -> std::vector<tree_digest::index_type> {
+  std::vector<tree_digest::index_type> res;
+  for (auto k=i+1; k<i+d.subtree_size(i); k+=d.subtree_size(k)) {
+    res.push_back(k);
+  }
+  return res;
+}
+
+/// digest of a sub-tree, irrespective of the name of its root
+auto
+anonymous_digest(const tree& t, const tree_digest& d, tree_digest::index_type i) -> digest_type {
+  std::string_view l = label(t).str();
+  digest_type h = hash_combine(hash_bytes(l.data(),l.size()),value_digest(value(t)));
+  for (auto k : children_indices(d,i)) {
+    h = hash_combine(h,d.subtree(k));
+  }
+  return h;
+}
+/// equality of two sub-trees, irrespective of the name of their roots
+auto
+same_anonymous_tree(const tree& x, const tree& y) -> bool {
+  if (label(x)!=label(y) || value(x)!=value(y)) return false;
+  const auto& xcs = children(x);
+  const auto& ycs = children(y);
+  return std::equal(begin(xcs),end(xcs),begin(ycs),end(ycs));
+}
+// utils }
+
+
+// value diff {
+template<class T> auto
+equal_bytes(const T& x, const T& y) -> bool {
+  return std::memcmp(&x,&y,sizeof(T))==0; // consistent with the digests (in particular for NaNs)
+}
+
+template<class T> auto
+diff_typed_values(const T* x, const T* y, I8 n, const node_value& y_val, const std::string& path, tree_patch& patch) -> void {
+  // runs of changed elements that are separated by less than `min_gap` unchanged elements are merged
+  constexpr I8 min_gap = 8;
+
+  std::vector<std::pair<I8,I8>> changed_ranges;
+  I8 n_changed = 0;
+  I8 i = 0;
+  while (i<n) {
+    if (equal_bytes(x[i],y[i])) { ++i; continue; }
+    I8 start = i;
+    I8 last_changed = i;
+    while (i<n && i-last_changed<=min_gap) {
+      if (!equal_bytes(x[i],y[i])) last_changed = i;
+      ++i;
+    }
+    changed_ranges.emplace_back(start,last_changed+1);
+    n_changed += last_changed+1-start;
+  }
+
+  if (2*n_changed > n) { // mostly changed: cheaper to replace the whole value
+    patch.emplace_back(set_value_op{path,clone(y_val)});
+    return;
+  }
+  for (auto [start,finish] : changed_ranges) {
+    patch.emplace_back(set_value_range_op{path,start,node_value(std::vector<T>(y+start,y+finish))});
+  }
+}
+
+auto
+diff_values(const node_value& x, const node_value& y, const std::string& path, tree_patch& patch) -> void {
+  data_type_id data_type = x.type_id();
+  if (data_type==data_type_id::MT || data_type!=y.type_id() || !same_shape(x,y)) {
+    patch.emplace_back(set_value_op{path,clone(y)});
+    return;
+  }
+  dispatch_on_data_type(
+    data_type,
+    [&]<class T>(T){ diff_typed_values(data_as<T>(x),data_as<T>(y),x.size(),y,path,patch); }
+  );
+}
+// value diff }
+
+
+// tree diff {
+struct diff_context {
+  const tree_digest& dx;
+  const tree_digest& dy;
+  tree_patch& patch;
+};
+
+auto
+diff_nodes(const tree& x, tree_digest::index_type ix, const tree& y, tree_digest::index_type iy, const std::string& path, diff_context& ctx) -> void {
+  // `x` and `y` have the same name
+  if (ctx.dx.subtree(ix)==ctx.dy.subtree(iy)) return; // identical sub-trees
+
+  tree_patch& patch = ctx.patch;
+
+  // node
+  if (ctx.dx.node(ix)!=ctx.dy.node(iy)) {
+    if (label(x)!=label(y)) {
+      patch.emplace_back(relabel_op{path,label(y)});
+    }
+    if (value(x)!=value(y)) {
+      diff_values(value(x),value(y),path,patch);
+    }
+  }
+
+  // children
+  const auto& xcs = children(x);
+  const auto& ycs = children(y);
+  auto x_indices = children_indices(ctx.dx,ix);
+  auto y_indices = children_indices(ctx.dy,iy);
+  int nx = xcs.size();
+  int ny = ycs.size();
+
+  /// match by name (sibling names are supposed to be unique)
+  std::vector<int> x_to_y(nx,-1);
+  std::vector<int> y_to_x(ny,-1);
+  for (int j=0; j<ny; ++j) {
+    auto pos = xcs.find_by_name(name(ycs[j]));
+    if (pos!=xcs.end()) {
+      int i = pos-xcs.begin();
+      if (x_to_y[i]==-1) {
+        x_to_y[i] = j;
+        y_to_x[j] = i;
+      }
+    }
+  }
+
+  /// among the unmatched children, find the ones that were renamed
+  std::vector<bool> is_renamed(nx,false);
+  std::unordered_multimap<digest_type,int> unmatched_x;
+  for (int i=0; i<nx; ++i) {
+    if (x_to_y[i]==-1) unmatched_x.emplace(anonymous_digest(xcs[i],ctx.dx,x_indices[i]),i);
+  }
+  if (unmatched_x.size()>0) {
+    for (int j=0; j<ny; ++j) {
+      if (y_to_x[j]!=-1) continue;
+      auto [first,last] = unmatched_x.equal_range(anonymous_digest(ycs[j],ctx.dy,y_indices[j]));
+      for (auto it=first; it!=last; ++it) {
+        int i = it->second;
+        if (x_to_y[i]==-1 && same_anonymous_tree(xcs[i],ycs[j])) {
+          x_to_y[i] = j;
+          y_to_x[j] = i;
+          is_renamed[i] = true;
+          break;
+        }
+      }
+    }
+  }
+
+  /// edit script
+  for (int i=0; i<nx; ++i) {
+    if (x_to_y[i]==-1) patch.emplace_back(rm_child_op{join_path(path,name(xcs[i]))});
+  }
+  for (int i=0; i<nx; ++i) {
+    if (is_renamed[i]) patch.emplace_back(rename_op{join_path(path,name(xcs[i])),name(ycs[x_to_y[i]])});
+  }
+  for (int i=0; i<nx; ++i) {
+    int j = x_to_y[i];
+    if (j!=-1 && !is_renamed[i]) {
+      diff_nodes(xcs[i],x_indices[i],ycs[j],y_indices[j],join_path(path,name(ycs[j])),ctx);
+    }
+  }
+  for (int j=0; j<ny; ++j) {
+    if (y_to_x[j]==-1) patch.emplace_back(add_child_op{path,clone(ycs[j])});
+  }
+
+  /// order of the children: the kept ones in their original order, then the added ones
+  std::vector<node_name> patched_order;
+  for (int i=0; i<nx; ++i) {
+    if (x_to_y[i]!=-1) patched_order.push_back(name(ycs[x_to_y[i]]));
+  }
+  for (int j=0; j<ny; ++j) {
+    if (y_to_x[j]==-1) patched_order.push_back(name(ycs[j]));
+  }
+  std::vector<node_name> y_order;
+  for (const tree& c : ycs) {
+    y_order.push_back(name(c));
+  }
+  if (patched_order!=y_order) {
+    patch.emplace_back(reorder_children_op{path,std::move(y_order)});
+  }
+}
+// tree diff }
+
+
+// apply patch {
+auto
+node_at(tree& t, const std::string& path) -> tree& {
+  if (path.empty()) return t;
+  tree* n = &t;
+  for (const auto& s : std_e::split(path,'/')) {
+    n = &get_child_by_name(*n,s);
+  }
+  return *n;
+}
+/// parent path and name of the node
+auto
+split_last(const std::string& path) -> std::pair<std::string,std::string> {
+  auto pos = path.rfind('/');
+  if (pos==std::string::npos) return {"",path};
+  return {path.substr(0,pos),path.substr(pos+1)};
+}
+
+auto
+apply_op(tree& t, add_child_op& op) -> void {
+  emplace_child(node_at(t,op.parent_path),std::move(op.child));
+}
+auto
+apply_op(tree& t, rm_child_op& op) -> void {
+  auto [parent_path,child_name] = split_last(op.path);
+  rm_child_by_name(node_at(t,parent_path),child_name);
+}
+auto
+apply_op(tree& t, rename_op& op) -> void {
+  if (op.path.empty()) {
+    name(t) = op.new_name;
+    return;
+  }
+  auto [parent_path,child_name] = split_last(op.path);
+  tree& parent = node_at(t,parent_path);
+  name(get_child_by_name(parent,child_name)) = op.new_name;
+}
+auto
+apply_op(tree& t, relabel_op& op) -> void {
+  label(node_at(t,op.path)) = op.new_label;
+}
+auto
+apply_op(tree& t, set_value_op& op) -> void {
+  set_value(node_at(t,op.path),std::move(op.new_value));
+}
+auto
+apply_op(tree& t, set_value_range_op& op) -> void {
+  node_value& val = mutable_value(node_at(t,op.path));
+  const node_value& new_elts = op.new_elements;
+  if (val.type_id()!=new_elts.type_id()) {
+    throw cgns_exception("Patch of node \""+op.path+"\": value of type "+val.data_type()
+                       + " can't be patched with elements of type "+new_elts.data_type());
+  }
+  if (op.start<0 || op.start+(I8)new_elts.size() > (I8)val.size()) {
+    throw cgns_exception("Patch of node \""+op.path+"\": elements out of the range of the value");
+  }
+  dispatch_on_data_type(
+    val.type_id(),
+    [&]<class T>(T){
+      const T* src = data_as<T>(new_elts);
+      std::copy(src,src+new_elts.size(),data_as<T>(val)+op.start);
+    }
+  );
+}
+auto
+apply_op(tree& t, reorder_children_op& op) -> void {
+  auto& cs = children(node_at(t,op.path));
+  if (op.names.size()!=cs.size()) {
+    throw cgns_exception("Patch of node \""+op.path+"\": the new order of the children does not match the number of children");
+  }
+  std::vector<int> positions;
+  positions.reserve(cs.size());
+  for (const auto& n : op.names) {
+    auto pos = cs.find_by_name(n);
+    if (pos==cs.end()) {
+      throw cgns_exception("Patch of node \""+op.path+"\": no child of name \""+n+"\"");
+    }
+    positions.push_back(pos-cs.begin());
+  }
+  std::vector<tree> reordered;
+  reordered.reserve(cs.size());
+  for (int pos : positions) {
+    reordered.push_back(std::move(cs[pos]));
+  }
+  {
+    untracked_name_assignments untracked;
+    for (size_t i=0; i<cs.size(); ++i) {
+      cs[i] = std::move(reordered[i]);
+    }
+  }
+  cs.invalidate_name_index();
+}
+// apply patch }
+
+} // anonymous
+
+
+auto
+tree_diff(const tree& x, const tree& y) -> tree_patch {
+  tree_patch patch;
+  tree_digest dx(x);
+  tree_digest dy(y);
+  if (name(x)!=name(y)) {
+    patch.emplace_back(rename_op{"",name(y)});
+  }
+  diff_context ctx = {dx,dy,patch};
+  diff_nodes(x,0,y,0,"",ctx);
+  return patch;
+}
+
+auto
+apply_patch(tree& t, tree_patch&& p) -> void {
+  for (patch_op& op : p) {
+    std::visit([&t](auto& typed_op){ apply_op(t,typed_op); },op);
+  }
+}
+
+
+} // cgns
+#endif // C++>17
@@ -0,0 +1,69 @@
+#pragma once
+
+
+#include <string>
+#include <variant>
+#include <vector>
+#include "cpp_cgns/base/tree.hpp"
+
+
+namespace cgns {
+
+
+// patch operations {
+// A node is designated by its path: the "/"-separated names from the root (excluded) to the node
+// The path of the root is ""
+struct add_child_op {
+  std::string parent_path;
+  tree child;
+};
+struct rm_child_op {
+  std::string path;
+};
+struct rename_op {
+  std::string path;
+  node_name new_name;
+};
+struct relabel_op {
+  std::string path;
+  node_label new_label;
+};
+struct set_value_op {
+  std::string path;
+  node_value new_value;
+};
+/// replaces elements [start,start+new_elements.size()) of the node value (viewed as a 1D array in memory order)
+struct set_value_range_op {
+  std::string path;
+  I8 start;
+  node_value new_elements;
+};
+/// reorders the children according to their names
+struct reorder_children_op {
+  std::string path;
+  std::vector<node_name> names;
+};
+
+using patch_op =
+  std::variant<
+    add_child_op,
+    rm_child_op,
+    rename_op,
+    relabel_op,
+    set_value_op,
+    set_value_range_op,
+    reorder_children_op
+  >;
+
+/// the operations are meant to be applied in order
+using tree_patch = std::vector<patch_op>;
+// patch operations }
+
+
+// [Sphinx Doc] tree diff {
+auto tree_diff(const tree& x, const tree& y) -> tree_patch;
+auto apply_patch(tree& t, tree_patch&& p) -> void;
+// [Sphinx Doc] tree diff }
+
+
+} // cgns
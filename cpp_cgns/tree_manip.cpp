@@ -4,6 +4,7 @@
 #include "std_e/utils/string.hpp"
 #include "std_e/future/contract.hpp"
 #include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 
@@ -15,31 +16,41 @@ namespace cgns {
 
 /// common predicates {
 auto
-is_of_name(const tree& t, const std::string& s) -> bool {
-  return name(t) == s;
+is_of_name(const tree& t, std::string_view s) -> bool {
+  return name(t).str() == s;
 }
 auto
-is_of_label(const tree& t, const std::string& s) -> bool {
-  return label(t) == s;
+is_of_label(const tree& t, label_query l) -> bool {
+  return l.matches(label(t));
 }
 auto
 is_one_of_labels(const tree& t, const std::vector<std::string>& labels) -> bool {
-  return std::any_of(begin(labels),end(labels),[&t](const std::string& label){ return is_of_label(t,label); });
+  return std::any_of(begin(labels),end(labels),[&t](const std::string& l){ return label(t)==l; });
+}
+auto
+is_one_of_labels(const tree& t, const std::vector<node_label>& labels) -> bool {
+  return std::any_of(begin(labels),end(labels),[&t](node_label l){ return label(t)==l; });
 }
 
 auto
-has_child_of_name(const tree& t, const std::string& name) -> bool {
-  auto predicate = [&](const tree& child){ return is_of_name(child,name); };
-  return has_child_by_predicate(t,predicate);
+has_child_of_name(const tree& t, std::string_view name) -> bool {
+  std::optional<node_name> n = as_name_query(name);
+  if (!n) return false;
+  const auto& cs = children(t);
+  return cs.find_by_name(*n) != cs.end();
 }
 auto
-has_child_of_label(const tree& t, const std::string& label) -> bool {
-  auto predicate = [&](const tree& child){ return is_of_label(child,label); };
+has_child_of_label(const tree& t, label_query label) -> bool {
+  auto predicate = [label](const tree& child){ return is_of_label(child,label); };
   return has_child_by_predicate(t,predicate);
 }
 auto
 has_node(const tree& t, const std::string& gen_path) -> bool {
-  auto ts = get_nodes_by_matching(t,gen_path);
+  return has_node(t,compiled_path(gen_path));
+}
+auto
+has_node(const tree& t, const compiled_path& path) -> bool {
+  auto ts = get_nodes_by_matching(t,path);
   if (ts.size() == 0) {
     return false;
   } else {
@@ -57,26 +68,63 @@ rm_child(tree& t, const tree& c) -> void {
   rm_child_by_predicate(t,predicate,e);
 }
 auto
-rm_child_by_name(tree& t, const std::string& name_) -> void {
-  auto predicate = [&](const tree& child){ return is_of_name(child,name_); };
-  const cgns_exception e("Impossible to erase child of name "+name_+" in tree "+name(t)+": no such child with such name");
-  rm_child_by_predicate(t,predicate,e);
+rm_child_by_name(tree& t, std::string_view name_) -> void {
+  auto& cs = children(t);
+  std::optional<node_name> n = as_name_query(name_);
+  auto pos = n ? cs.find_by_name(*n) : cs.end();
+  if (pos==cs.end()) {
+    throw cgns_exception("Impossible to erase child of name "+std::string(name_)+" in tree "+name(t)+": no such child with such name");
+  }
+  cs.erase(pos);
 }
-auto rm_children_by_names(tree& t, const std::vector<std::string>& names) -> void {
-  for (const auto& name : names) {
-    rm_child_by_name(t,name);
+auto
+rm_children_by_names(tree& t, const std::vector<std::string>& names) -> void {
+  // as calling `rm_child_by_name` for each name: only the first child of each name is removed
+  // (a name given k times removes the first k children of that name)
+  // check first, so that nothing is removed if a name is not found
+  for (const auto& n : names) {
+    if (!has_child_of_name(t,n)) {
+      throw cgns_exception("Impossible to erase child of name "+n+" in tree "+name(t)+": no such child with such name");
+    }
+  }
+  std::unordered_map<node_name,int> n_to_rm;
+  for (const auto& n : names) {
+    ++n_to_rm[node_name(n)];
   }
+  std::unordered_map<node_name,int> n_found;
+  for (const tree& c : children(t)) {
+    if (n_to_rm.contains(name(c))) ++n_found[name(c)];
+  }
+  for (const auto& [n,k] : n_to_rm) {
+    if (n_found[n]<k) {
+      throw cgns_exception("Impossible to erase child of name "+n+" in tree "+name(t)+": not enough children with such name");
+    }
+  }
+
+  auto predicate = [&n_to_rm](const tree& child){
+    auto it = n_to_rm.find(name(child));
+    if (it==n_to_rm.end() || it->second==0) return false;
+    --it->second;
+    return true;
+  };
+  rm_children_by_predicate(t,predicate);
 }
 
 auto
-rm_child_by_label(tree& t, const std::string& label) -> void {
-  auto predicate = [&](const tree& child){ return is_of_label(child,label); };
-  const cgns_exception e("Impossible to erase child of label "+label+" in tree "+name(t)+": no such child with such label");
+rm_child_by_label(tree& t, label_query label) -> void {
+  auto predicate = [label](const tree& child){ return is_of_label(child,label); };
+  const cgns_exception e("Impossible to erase child of label "+std::string(label.str())+" in tree "+name(t)+": no such child with such label");
   rm_child_by_predicate(t,predicate,e);
 }
 auto
-rm_children_by_label(tree& t, const std::string& label) -> void {
-  auto predicate = [&](const tree& child){ return is_of_label(child,label); };
+rm_children_by_label(tree& t, label_query label) -> void {
+  auto predicate = [label](const tree& child){ return is_of_label(child,label); };
+  rm_children_by_predicate(t,predicate);
+}
+auto
+rm_children_by_labels(tree& t, const std::vector<std::string>& labels) -> void {
+  std::vector<node_label> label_ids = find_labels(labels); // look up once (without interning), then compare ids
+  auto predicate = [&label_ids](const tree& child){ return is_one_of_labels(child,label_ids); };
   rm_children_by_predicate(t,predicate);
 }
 /// node removal }
@@ -84,8 +132,10 @@ rm_children_by_label(tree& t, const std::string& label) -> void {
 
 auto
 replace_child(tree& t, tree&& c) -> tree& {
-  if (has_child_of_name(t,name(c))) {
-    rm_child_by_name(t,name(c));
+  auto& cs = children(t);
+  auto pos = cs.find_by_name(name(c));
+  if (pos!=cs.end()) {
+    cs.erase(pos); // the name index is updated, not rebuilt
   }
   return emplace_child(t,std::move(c));
 }
@@ -2,23 +2,29 @@
 
 
 #include "cpp_cgns/tree.hpp"
+#include "cpp_cgns/compiled_path.hpp"
+#include "cpp_cgns/tree_views.hpp"
 #include "std_e/graph/algorithm/algo_adjacencies.hpp"
 #include "std_e/utils/concatenate.hpp"
+#include <unordered_set>
 
 
 namespace cgns {
 
 
 // [Sphinx Doc] Tree manip {
+// Names are searched as strings: a string longer than a node name can't match any node (it is not an error)
 // predicates {
-auto is_of_name(const tree& tree, const std::string& name) -> bool;
-auto is_of_label(const tree& tree, const std::string& label) -> bool;
+auto is_of_name(const tree& tree, std::string_view name) -> bool;
+auto is_of_label(const tree& tree, label_query label) -> bool;
 auto is_one_of_labels(const tree& tree, const std::vector<std::string>& labels) -> bool;
+auto is_one_of_labels(const tree& tree, const std::vector<node_label>& labels) -> bool;
 
 template<class Unary_pred> auto has_child_by_predicate(const tree& t, Unary_pred p) -> bool;
-                           auto has_child_of_name(const tree& t, const std::string& name) -> bool;
-                           auto has_child_of_label(const tree& t, const std::string& name) -> bool;
+                           auto has_child_of_name(const tree& t, std::string_view name) -> bool;
+                           auto has_child_of_label(const tree& t, label_query label) -> bool;
                            auto has_node(const tree& t, const std::string& gen_path) -> bool;
+                           auto has_node(const tree& t, const compiled_path& path) -> bool;
 // predicates }
 
 
@@ -27,37 +33,42 @@ template<class Tree, class Unary_pred> auto get_children_by_predicate (Tree& t,
 template<class Tree, class Unary_pred> auto get_child_by_predicate    (Tree& t, Unary_pred p, const cgns_exception& e) -> tree_ref<Tree>;
 template<class Tree, class Unary_pred> auto get_child_by_predicate    (Tree& t, Unary_pred p)                          -> tree_ref<Tree>;
 
-template<class Tree>                   auto get_child_by_name         (Tree& t, const std::string& name ) -> tree_ref<Tree>;
+template<class Tree>                   auto get_child_by_name         (Tree& t, std::string_view name) -> tree_ref<Tree>;
 
-template<class Tree>                   auto get_child_by_label        (Tree& t, const std::string& label) -> tree_ref<Tree>;
-template<class Tree>                   auto get_children_by_label     (Tree& t, const std::string& label) -> Tree_range<Tree>;
+template<class Tree>                   auto get_child_by_label        (Tree& t, label_query label) -> tree_ref<Tree>;
+template<class Tree>                   auto get_children_by_label     (Tree& t, label_query label) -> Tree_range<Tree>;
 template<class Tree>                   auto get_children_by_labels    (Tree& t, const std::vector<std::string>& labels) -> Tree_range<Tree>;
 
 template<class Tree>                   auto get_node_by_matching      (Tree& t, const std::string& gen_path) -> Tree&;
+template<class Tree>                   auto get_node_by_matching      (Tree& t, const compiled_path& path) -> Tree&;
 template<class Tree>                   auto get_nodes_by_matching     (Tree& t, const std::string& gen_path) -> Tree_range<Tree>;
+template<class Tree>                   auto get_nodes_by_matching     (Tree& t, const compiled_path& path) -> Tree_range<Tree>;
 template<class Tree>                   auto get_nodes_by_matching     (Tree& t, const std::vector<std::string>& gen_paths) -> Tree_range<Tree>;
+template<class Tree>                   auto get_nodes_by_matching     (Tree& t, const std::vector<compiled_path>& paths) -> Tree_range<Tree>;
 
-template<class Tree, class Unary_pred> auto get_node_by_predicate     (Tree& t, Unary_pred p)                -> tree_ref<Tree>;
+template<class Tree, class Unary_pred> auto get_node_by_predicate     (Tree& t, Unary_pred p, int max_depth = unbounded_depth) -> tree_ref<Tree>;
 template<class Tree, class Unary_pred> auto get_nodes_by_predicate    (Tree& t, Unary_pred p)                -> Tree_range<Tree>;
 
-template<class Tree>                   auto get_node_by_name          (Tree& t, const std::string& name )    -> tree_ref<Tree>;
-template<class Tree>                   auto get_node_by_label         (Tree& t, const std::string& label)    -> tree_ref<Tree>;
-template<class Tree>                   auto get_nodes_by_name         (Tree& t, const std::string& name )    -> Tree_range<Tree>;
-template<class Tree>                   auto get_nodes_by_label        (Tree& t, const std::string& label)    -> Tree_range<Tree>;
+template<class Tree>                   auto get_node_by_name          (Tree& t, std::string_view name, int max_depth = unbounded_depth) -> tree_ref<Tree>;
+template<class Tree>                   auto get_node_by_label         (Tree& t, label_query label, int max_depth = unbounded_depth)     -> tree_ref<Tree>;
+template<class Tree>                   auto get_nodes_by_name         (Tree& t, std::string_view name)       -> Tree_range<Tree>;
+template<class Tree>                   auto get_nodes_by_label        (Tree& t, label_query label)           -> Tree_range<Tree>;
 template<class Tree>                   auto get_nodes_by_labels       (Tree& t, const std::vector<std::string>& label) -> Tree_range<Tree>;
 
+/// with a non-const tree, the views are mutable: a value shared by `cow_clone` is copied first (pass a const tree to only read it)
 template<class T, int N=1, class Tree> auto get_value                 (Tree& t);
 template<class T, int N=1, class Tree> auto get_child_value_by_name   (Tree& t, const std::string& s);
-template<class T, int N=1, class Tree> auto get_child_value_by_label  (Tree& t, const std::string& s);
+template<class T, int N=1, class Tree> auto get_child_value_by_label  (Tree& t, label_query label);
 template<class T, int N=1, class Tree> auto get_node_value_by_matching(Tree& t, const std::string& s);
 // searches }
 
 // removal {
 auto rm_child(tree& t, const tree& c) -> void;
-auto rm_child_by_name(tree& t, const std::string& name) -> void;
-auto rm_children_by_names(tree& t, const std::vector<std::string>& names) -> void;
-auto rm_child_by_label(tree& t, const std::string& label) -> void;
-auto rm_children_by_label(tree& t, const std::string& label) -> void;
+auto rm_child_by_name(tree& t, std::string_view name) -> void;
+auto rm_children_by_names(tree& t, const std::vector<std::string>& names) -> void; // the first child of each name
+auto rm_child_by_label(tree& t, label_query label) -> void;
+auto rm_children_by_label(tree& t, label_query label) -> void;
+auto rm_children_by_labels(tree& t, const std::vector<std::string>& labels) -> void;
 
 template<class Tree_range>
 auto rm_children(tree& t, Tree_range& children) -> void;
@@ -113,31 +124,38 @@ get_child_by_predicate(Tree& t, Unary_pred p) -> tree_ref<Tree> {
 
 /// common searches {
 template<class Tree> auto
-get_children_by_label(Tree& t, const std::string& label) -> Tree_range<Tree> {
-  auto predicate = [&](const tree& child){ return is_of_label(child,label); };
+get_children_by_label(Tree& t, label_query label) -> Tree_range<Tree> {
+  auto predicate = [label](const tree& child){ return is_of_label(child,label); };
   return get_children_by_predicate(t,predicate);
 }
 template<class Tree> auto
 get_children_by_labels(Tree& t, const std::vector<std::string>& labels) -> Tree_range<Tree> {
-  auto predicate = [&](const tree& child){ return is_one_of_labels(child,labels); };
+  std::vector<node_label> label_ids = find_labels(labels); // look up once (without interning), then compare ids
+  auto predicate = [&](const tree& child){ return is_one_of_labels(child,label_ids); };
   return get_children_by_predicate(t,predicate);
 }
 template<class Tree> auto
 get_children_by_name_or_label(Tree& t, const std::string& s) -> Tree_range<Tree> {
-  auto predicate = [&](const tree& child){ return is_of_name(child,s) || is_of_label(child,s); };
+  std::optional<node_name> n = as_name_query(s);
+  std::optional<node_label> l = node_label::find(s); // never interned: no node has this label
+  auto predicate = [&](const tree& child){ return (n && name(child)==*n) || (l && is_of_label(child,*l)); };
   return get_children_by_predicate(t,predicate);
 }
 
 template<class Tree> auto
-get_child_by_name(Tree& t, const std::string& name_) -> tree_ref<Tree> {
-  auto predicate = [&](const tree& child){ return is_of_name(child,name_); };
-  cgns_exception e("Child of name \""+name_+"\" not found in tree \""+name(t)+"\"");
-  return get_child_by_predicate(t,predicate,e);
+get_child_by_name(Tree& t, std::string_view name_) -> tree_ref<Tree> {
+  auto& cs = children(t);
+  std::optional<node_name> n = as_name_query(name_);
+  auto pos = n ? cs.find_by_name(*n) : cs.end();
+  if (pos==cs.end()) {
+    throw cgns_exception("Child of name \""+std::string(name_)+"\" not found in tree \""+name(t)+"\"");
+  }
+  return *pos;
 }
 template<class Tree> auto
-get_child_by_label(Tree& t, const std::string& label) -> tree_ref<Tree> {
-  auto predicate = [&](const tree& child){ return is_of_label(child,label); };
-  cgns_exception e("Child of label \""+label+"\" not found in tree \""+name(t)+"\"");
+get_child_by_label(Tree& t, label_query label) -> tree_ref<Tree> {
+  auto predicate = [label](const tree& child){ return is_of_label(child,label); };
+  cgns_exception e("Child of label \""+std::string(label.str())+"\" not found in tree \""+name(t)+"\"");
   return get_child_by_predicate(t,predicate,e);
 }
 
@@ -147,9 +165,9 @@ template<class Tree>
 // requires Tree==tree or Tree==const tree
 class visitor_for_matching_path {
   public:
-    visitor_for_matching_path(const std::string& gen_path)
-      : identifiers(std_e::split(gen_path,'/'))
-      , max_depth(identifiers.size()-1)
+    visitor_for_matching_path(const compiled_path& path)
+      : path(path)
+      , max_depth(path.size()-1)
       , depth(0)
     {}
 
@@ -157,7 +175,7 @@ class visitor_for_matching_path {
     pre(Tree& t) -> std_e::step {
       STD_E_ASSERT(depth>=0);
       if (depth > max_depth) return std_e::step::over; // continue if gen_path reached the end
-      bool is_matching = identifiers[depth]==name(t) || identifiers[depth]==label(t);
+      bool is_matching = path[depth].matches(t);
       if (!is_matching)                    return std_e::step::over; // prune
       if (is_matching && depth<max_depth)  return std_e::step::into; // continue to match path
       if (is_matching && depth==max_depth) return std_e::step::out ; // found!
@@ -176,21 +194,25 @@ class visitor_for_matching_path {
       ++depth;
     }
   private:
-    const std::vector<std::string> identifiers;
+    const compiled_path& path;
     const int max_depth;
 
     int depth;
 };
 template<class Tree> auto
-get_node_by_matching(Tree& t, const std::string& gen_path) -> Tree& {
-  visitor_for_matching_path<Tree> v(gen_path);
+get_node_by_matching(Tree& t, const compiled_path& path) -> Tree& {
+  visitor_for_matching_path<Tree> v(path);
   auto res = std_e::depth_first_search_adjacencies(children(t),v);
   if (res == children(t).end()) {
-    throw cgns_exception("No sub-tree matching \""+gen_path+"\" in tree \""+name(t)+"\"");
+    throw cgns_exception("No sub-tree matching \""+path.str()+"\" in tree \""+name(t)+"\"");
   } else {
     return *res;
   }
 }
+template<class Tree> auto
+get_node_by_matching(Tree& t, const std::string& gen_path) -> Tree& {
+  return get_node_by_matching(t,compiled_path(gen_path));
+}
 //// get_node_by_matching }
 
 //// get_nodes_by_matching {
@@ -227,16 +249,28 @@ class visitor_for_matching_paths : public visitor_for_matching_path<Tree> {
 };
 
 template<class Tree> auto
-get_nodes_by_matching(Tree& t, const std::string& gen_path) -> Tree_range<Tree> {
-  visitor_for_matching_paths<Tree> v(gen_path);
+get_nodes_by_matching(Tree& t, const compiled_path& path) -> Tree_range<Tree> {
+  visitor_for_matching_paths<Tree> v(path);
   std_e::depth_first_prune_adjacencies(children(t),v);
   return v.retrieve_nodes();
 }
 template<class Tree> auto
+get_nodes_by_matching(Tree& t, const std::string& gen_path) -> Tree_range<Tree> {
+  return get_nodes_by_matching(t,compiled_path(gen_path));
+}
+template<class Tree> auto
+get_nodes_by_matching(Tree& t, const std::vector<compiled_path>& paths) -> Tree_range<Tree> {
+  Tree_range<Tree> res;
+  for (const auto& path : paths) {
+    std_e::append(res,get_nodes_by_matching(t,path));
+  }
+  return res;
+}
+template<class Tree> auto
 get_nodes_by_matching(Tree& t, const std::vector<std::string>& gen_paths) -> Tree_range<Tree> {
   Tree_range<Tree> res;
   for (const auto& gen_path : gen_paths) {
-    std_e::append(res,get_nodes_by_matching(t,gen_path));
+    std_e::append(res,get_nodes_by_matching(t,compiled_path(gen_path)));
   }
   return res;
 }
@@ -252,30 +286,52 @@ get_nodes_by_predicate(Tree& t, Unary_pred p) -> Tree_range<Tree> {
   return ts;
 }
 template<class Tree> auto
-get_nodes_by_name(Tree& t, const std::string& name) -> Tree_range<Tree> {
-  auto predicate = [&](auto& child){ return is_of_name(child,name); };
+get_nodes_by_name(Tree& t, std::string_view name_) -> Tree_range<Tree> {
+  std::optional<node_name> n = as_name_query(name_);
+  if (!n) return {};
+  auto predicate = [&](auto& child){ return name(child)==*n; };
   return get_nodes_by_predicate(t,predicate);
 }
 template<class Tree> auto
-get_nodes_by_label(Tree& t, const std::string& label) -> Tree_range<Tree> {
-  auto predicate = [&](auto& child){ return is_of_label(child,label); };
+get_nodes_by_label(Tree& t, label_query label) -> Tree_range<Tree> {
+  auto predicate = [label](auto& child){ return is_of_label(child,label); };
   return get_nodes_by_predicate(t,predicate);
 }
 template<class Tree> auto
 get_nodes_by_labels(Tree& t, const std::vector<std::string>& labels) -> Tree_range<Tree> {
-  auto predicate = [&](auto& child){ return is_one_of_labels(child,labels); };
+  std::vector<node_label> label_ids = find_labels(labels); // look up once (without interning), then compare ids
+  auto predicate = [&](auto& child){ return is_one_of_labels(child,label_ids); };
   return get_nodes_by_predicate(t,predicate);
 }
+//// get_nodes_by_predicate }
+
+//// get_node_by_predicate {
+// The first node found in preorder (the root included) is returned
+// The search stops at the first match, so finding a node near the root does not traverse the whole tree
+template<class Tree, class Unary_pred> auto
+get_node_by_predicate(Tree& t, Unary_pred p, int max_depth) -> tree_ref<Tree> {
+  for (Tree& n : preorder_nodes(t,max_depth)) {
+    if (p(n)) return n;
+  }
+  throw cgns_exception("No node satisfying predicate found in tree \""+name(t)+"\"");
+}
 template<class Tree> auto
-get_node_by_name(Tree& t, const std::string& s) -> tree_ref<Tree> {
-  auto ts = get_nodes_by_name(t,s);
-  if (ts.size() == 0) {
-    throw cgns_exception("No child of name\""+s+"\" in tree \""+name(t)+"\"");
-  } else {
-    return ts[0].get();
+get_node_by_name(Tree& t, std::string_view s, int max_depth) -> tree_ref<Tree> {
+  if (std::optional<node_name> nm = as_name_query(s)) {
+    for (Tree& n : preorder_nodes(t,max_depth)) {
+      if (name(n)==*nm) return n;
+    }
   }
+  throw cgns_exception("No node of name \""+std::string(s)+"\" in tree \""+name(t)+"\"");
 }
-//// get_nodes_by_predicate }
+template<class Tree> auto
+get_node_by_label(Tree& t, label_query l, int max_depth) -> tree_ref<Tree> {
+  for (Tree& n : preorder_nodes(t,max_depth)) {
+    if (l.matches(label(n))) return n;
+  }
+  throw cgns_exception("No node of label \""+std::string(l.str())+"\" in tree \""+name(t)+"\"");
+}
+//// get_node_by_predicate }
 
 
 /// common searches }
@@ -293,25 +349,25 @@ throw_if_incorrect_array_type(const tree& x) -> void {
 template<class T, int N, class Tree> auto
 get_value(Tree& t) {
   throw_if_incorrect_array_type<T,N>(t);
-  return view_as_array<T,N>(value(t));
+  return view_as_array<T,N>(value_of_same_constness(t));
 }
 template<class T, int N, class Tree> auto
 get_child_value_by_name(Tree& t, const std::string& s) {
   auto&& n = get_child_by_name(t,s);
   throw_if_incorrect_array_type<T,N>(n);
-  return view_as_array<T,N>(value(n));
+  return view_as_array<T,N>(value_of_same_constness(n));
 }
 template<class T, int N, class Tree> auto
-get_child_value_by_label(Tree& t, const std::string& s) {
-  Tree& n = get_child_by_label(t,s);
+get_child_value_by_label(Tree& t, label_query label) {
+  Tree& n = get_child_by_label(t,label);
   throw_if_incorrect_array_type<T,N>(n);
-  return view_as_array<T,N>(value(n));
+  return view_as_array<T,N>(value_of_same_constness(n));
 }
 template<class T, int N, class Tree> auto
 get_node_value_by_matching(Tree& t, const std::string& s) {
   Tree& n = get_node_by_matching(t,s);
   throw_if_incorrect_array_type<T,N>(n);
-  return view_as_array<T,N>(value(n));
+  return view_as_array<T,N>(value_of_same_constness(n));
 }
 // find and give value }
 
@@ -334,29 +390,43 @@ rm_child_by_predicate(tree& t, Unary_predicate p) -> void {
 }
 template<class Unary_predicate> auto
 rm_children_by_predicate(tree& t, Unary_predicate p) -> void {
+  // single pass: the kept nodes are compacted at the beginning (in order), then the tail is erased at once
   auto& cs = children(t);
-  auto not_p = [p](const auto& x){ return !p(x); };
-  auto pos = std::stable_partition(begin(cs),end(cs),not_p); // move nodes to be deleted at the end
+  auto pos = end(cs);
+  {
+    untracked_name_assignments untracked;
+    pos = std::remove_if(begin(cs),end(cs),p);
+  }
+  cs.invalidate_name_index();
   cs.erase(pos,end(cs));
 }
 
 template<class Tree_range>
-auto rm_children(tree& t, Tree_range& children) -> void {
-  // deleting from a vector is complicated because of iterator invalidation
-  // here we need to register the names, then erase
-  std::vector<std::string> child_names(children.size());
-  std::transform(begin(children),end(children),begin(child_names),[](const tree& c){ return name(c); });
-  for (const auto& name : child_names) {
-    rm_child_by_name(t,name);
+auto rm_children(tree& t, Tree_range& children_to_rm) -> void {
+  // the children to remove are identified by their address
+  std::unordered_set<const tree*> to_rm;
+  to_rm.reserve(children_to_rm.size());
+  for (const tree& c : children_to_rm) {
+    to_rm.insert(&c);
   }
+  auto is_to_rm = [&to_rm](const tree& c){ return to_rm.contains(&c); };
+
+  // check first, so that nothing is removed if a node is not a child of `t`
+  const auto& cs = children(t);
+  if (std::count_if(begin(cs),end(cs),is_to_rm) != (std::ptrdiff_t)to_rm.size()) {
+    throw cgns_exception("Impossible to erase children of tree "+name(t)+": some nodes to erase are not children of the tree");
+  }
+  rm_children_by_predicate(t,is_to_rm);
 }
 /// node removal }
 
 
 template<class Tree> auto
 get_child_by_name_or_create(Tree& t, tree&& c) -> Tree& {
-  if (has_child_of_name(t,name(c))) {
-    return get_child_by_name(t,name(c));
+  auto& cs = children(t);
+  auto pos = cs.find_by_name(name(c));
+  if (pos!=cs.end()) {
+    return *pos;
   } else {
     return emplace_child(t,std::move(c));
   }
@@ -0,0 +1,260 @@
+#pragma once
+
+
+#include <array>
+#include <vector>
+#include <ranges>
+#include <limits>
+#include "cpp_cgns/tree.hpp"
+#include "cpp_cgns/compiled_path.hpp"
+
+
+namespace cgns {
+
+
+// Lazy counterparts of the search functions of tree_manip.hpp
+// Contrary to e.g. `get_nodes_by_predicate`, they do not gather the results in a Tree_range:
+// the nodes are found one by one while iterating, so they do not allocate and can be stopped early
+// WARNING: the tree must not be modified while it is iterated over
+// Note: use the tree_manip.hpp functions if a stable snapshot of the results is needed
+
+inline constexpr int unbounded_depth = std::numeric_limits<int>::max();
+
+
+// [Sphinx Doc] tree views {
+template<class Tree, class Unary_pred> auto children_by_predicate(Tree& t, Unary_pred p);
+template<class Tree>                   auto children_by_name     (Tree& t, std::string_view name);
+template<class Tree>                   auto children_by_label    (Tree& t, label_query label);
+
+template<class Tree>                   auto preorder_nodes       (Tree& t, int max_depth = unbounded_depth);
+template<class Tree, class Unary_pred> auto nodes_by_predicate   (Tree& t, Unary_pred p, int max_depth = unbounded_depth);
+template<class Tree>                   auto nodes_by_name        (Tree& t, std::string_view name, int max_depth = unbounded_depth);
+template<class Tree>                   auto nodes_by_label       (Tree& t, label_query label, int max_depth = unbounded_depth);
+template<class Tree>                   auto nodes_by_matching    (Tree& t, const compiled_path& path);
+// [Sphinx Doc] tree views }
+
+
+// ====================== impl ======================
+
+// depth-first range {
+/// Tells, for a node at a given depth (the root being at depth 0),
+/// if it is part of the range and if its children must be visited
+struct node_selection {
+  bool select;
+  bool descend;
+};
+
+struct preorder_selector {
+  int max_depth;
+
+  auto
+  operator()(const tree&, int depth) const -> node_selection {
+    return {true, depth<max_depth};
+  }
+};
+
+struct matching_path_selector {
+  const compiled_path* path;
+
+  auto
+  operator()(const tree& t, int depth) const -> node_selection {
+    if (depth==0) return {false, true}; // the root itself is not part of the path
+    bool is_matching = (*path)[depth-1].matches(t);
+    return {is_matching && depth==path->size(), is_matching && depth<path->size()};
+  }
+};
+
+
+// Preorder depth-first range over the nodes of a tree
+// The nodes that are visited and returned are chosen by a `Selector`, called as `sel(node,depth) -> node_selection`
+// The traversal stack is stored inline up to `inline_depth` levels (CGNS trees are usually shallow),
+// so iterating does not allocate in practice
+template<class Tree, class Selector>
+// requires Tree==tree or Tree==const tree
+class depth_first_range : public std::ranges::view_interface<depth_first_range<Tree,Selector>> {
+  public:
+    static constexpr int inline_depth = 16;
+
+    class iterator {
+      public:
+        using value_type = std::remove_const_t<Tree>;
+        using difference_type = std::ptrdiff_t;
+        using reference = Tree&;
+
+      // ctors
+        iterator() = default;
+
+        iterator(Tree* root, const Selector* sel)
+          : sel(sel)
+          , current(root)
+        {
+          settle();
+        }
+
+      // iterator interface
+        auto
+        operator*() const -> Tree& {
+          return *current;
+        }
+        auto
+        operator->() const -> Tree* {
+          return current;
+        }
+        auto
+        operator++() -> iterator& {
+          move_to_next();
+          settle();
+          return *this;
+        }
+        auto
+        operator++(int) -> void {
+          ++*this;
+        }
+
+        friend auto
+        operator==(const iterator& it, std::default_sentinel_t) -> bool {
+          return it.current==nullptr;
+        }
+
+      // access
+        /// depth of the current node with respect to the root of the range
+        auto
+        depth() const -> int {
+          return n_frame;
+        }
+      private:
+        struct frame {
+          Tree* parent;
+          int child_index;
+        };
+
+      // stack {
+        auto
+        top() -> frame& {
+          return n_frame<=inline_depth ? inline_frames[n_frame-1] : overflow_frames.back();
+        }
+        auto
+        push(frame f) -> void {
+          if (n_frame<inline_depth) {
+            inline_frames[n_frame] = f;
+          } else {
+            overflow_frames.push_back(f);
+          }
+          ++n_frame;
+        }
+        auto
+        pop() -> void {
+          if (n_frame>inline_depth) {
+            overflow_frames.pop_back();
+          }
+          --n_frame;
+        }
+      // stack }
+
+        /// goes to the next node in preorder, without descending if the selector said so
+        auto
+        move_to_next() -> void {
+          auto& cs = children(*current);
+          if (descend_current && cs.size()>0) {
+            push({current,0});
+            current = &cs[0];
+            return;
+          }
+          while (n_frame>0) {
+            frame& f = top();
+            auto& siblings = children(*f.parent);
+            ++f.child_index;
+            if (f.child_index < (int)siblings.size()) {
+              current = &siblings[f.child_index];
+              return;
+            }
+            pop();
+          }
+          current = nullptr;
+        }
+        /// goes forward until a selected node is found
+        auto
+        settle() -> void {
+          while (current!=nullptr) {
+            node_selection s = (*sel)(*current,n_frame);
+            descend_current = s.descend;
+            if (s.select) return;
+            move_to_next();
+          }
+        }
+
+        const Selector* sel = nullptr;
+        Tree* current = nullptr;
+        bool descend_current = false;
+
+        int n_frame = 0;
+        std::array<frame,inline_depth> inline_frames;
+        std::vector<frame> overflow_frames;
+    };
+
+  // ctors
+    depth_first_range() = default;
+
+    depth_first_range(Tree& root, Selector sel)
+      : root(&root)
+      , sel(std::move(sel))
+    {}
+
+  // range interface
+    auto
+    begin() const -> iterator {
+      return iterator(root,&sel);
+    }
+    auto
+    end() const -> std::default_sentinel_t {
+      return std::default_sentinel;
+    }
+  private:
+    Tree* root = nullptr;
+    Selector sel;
+};
+// depth-first range }
+
+
+// children {
+template<class Tree, class Unary_pred> auto
+children_by_predicate(Tree& t, Unary_pred p) {
+  return children(t) | std::views::filter(std::move(p));
+}
+template<class Tree> auto
+children_by_name(Tree& t, std::string_view name) {
+  return children_by_predicate(t,[n=as_name_query(name)](const tree& c){ return n && cgns::name(c)==*n; });
+}
+template<class Tree> auto
+children_by_label(Tree& t, label_query label) {
+  return children_by_predicate(t,[l=label](const tree& c){ return l.matches(cgns::label(c)); });
+}
+// children }
+
+
+// whole tree {
+template<class Tree> auto
+preorder_nodes(Tree& t, int max_depth) {
+  return depth_first_range<Tree,preorder_selector>(t,preorder_selector{max_depth});
+}
+template<class Tree, class Unary_pred> auto
+nodes_by_predicate(Tree& t, Unary_pred p, int max_depth) {
+  return preorder_nodes(t,max_depth) | std::views::filter(std::move(p));
+}
+template<class Tree> auto
+nodes_by_name(Tree& t, std::string_view name, int max_depth) {
+  return nodes_by_predicate(t,[nm=as_name_query(name)](const tree& n){ return nm && cgns::name(n)==*nm; },max_depth);
+}
+template<class Tree> auto
+nodes_by_label(Tree& t, label_query label, int max_depth) {
+  return nodes_by_predicate(t,[l=label](const tree& n){ return l.matches(cgns::label(n)); },max_depth);
+}
+/// WARNING: `path` must outlive the returned range
+template<class Tree> auto
+nodes_by_matching(Tree& t, const compiled_path& path) {
+  return depth_first_range<Tree,matching_path_selector>(t,matching_path_selector{&path});
+}
+// whole tree }
+
+
+} // cgns